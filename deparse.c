@@ -38,6 +38,7 @@
 #include "nodes/nodeFuncs.h"
 #include "nodes/plannodes.h"
 #include "optimizer/clauses.h"
+#include "optimizer/pathnode.h"
 #include "optimizer/prep.h"
 #include "optimizer/tlist.h"
 #if PG_VERSION_NUM>=120000
@@ -144,6 +145,7 @@ static void deparseAggref(Aggref *node, deparse_expr_cxt *context);
 static void appendGroupByClause(List *tlist, deparse_expr_cxt *context);
 static void appendAggOrderBy(List *orderList, List *targetList,
 				 deparse_expr_cxt *context);
+static void appendOrderByClause(List *pathkeys, deparse_expr_cxt *context);
 static void appendFunctionName(Oid funcid, deparse_expr_cxt *context);
 static Node *deparseSortGroupClause(Index ref, List *tlist,
 					   deparse_expr_cxt *context);
@@ -238,7 +240,9 @@ foreign_expr_walker(Node *node,
 			if (bms_is_member(var->varno, glob_cxt->relids) &&
 				var->varlevelsup == 0)
 			{
-				if (var->varattno <= 0 || !bms_is_member(var->varattno - FirstLowInvalidHeapAttributeNumber, fpinfo->vops_attrs))
+				/* Attributes are mapped to VOPS table of the base relation containing the Var */
+				PgFdwRelationInfo *var_fpinfo = (PgFdwRelationInfo *) find_base_rel(glob_cxt->root, var->varno)->fdw_private;
+				if (var->varattno <= 0 || !bms_is_member(var->varattno - FirstLowInvalidHeapAttributeNumber, var_fpinfo->vops_attrs))
 				{
 					return false;
 				}
@@ -537,8 +541,13 @@ vopsDeparseSelectStmtForRel(StringInfo buf, PlannerInfo *root, RelOptInfo *rel,
 		}
 	}
 
+	/* Add ORDER BY clause if we found any useful pathkeys */
+	if (pathkeys)
+		appendOrderByClause(pathkeys, &context);
 
-	Assert(!pathkeys);
+	/* Add LIMIT clause if number of needed VOPS tuples is known */
+	if (fpinfo->limit_tuples > 0)
+		appendStringInfo(buf, " LIMIT %.0f", fpinfo->limit_tuples);
 
 	/* Add any necessary FOR UPDATE/SHARE. */
 	deparseLockingClause(&context);
@@ -573,6 +582,41 @@ deparseSelectSql(List *tlist, List **retrieved_attrs, deparse_expr_cxt *context)
 	{
 		/* For a join relation use the input tlist */
 		deparseExplicitTargetList(tlist, retrieved_attrs, context);
+
+		/*
+		 * Mask of tile elements satisfying conditions is returned as the last
+		 * column: global filter mask set by WHERE clause can not be used for
+		 * a join, because the joined tuple may be produced after evaluation of
+		 * conditions for other tuples.
+		 */
+		if (fpinfo->mask_conds != NIL)
+		{
+			ListCell   *lc;
+			int			i;
+
+			appendStringInfoString(buf, ", ");
+			for (i = 1; i < list_length(fpinfo->mask_conds); i++)
+			{
+				appendStringInfoString(buf, "vops_bool_and(");
+			}
+			i = 0;
+			foreach(lc, fpinfo->mask_conds)
+			{
+				RestrictInfo *ri = (RestrictInfo *) lfirst(lc);
+
+				if (i != 0)
+				{
+					appendStringInfoString(buf, ", ");
+				}
+				appendStringInfoChar(buf, '(');
+				deparseExpr(ri->clause, context);
+				appendStringInfoChar(buf, ')');
+				if (i++ != 0)
+				{
+					appendStringInfoChar(buf, ')');
+				}
+			}
+		}
 	}
 	else
 	{
@@ -886,27 +930,66 @@ static void
 deparseFromExprForRel(StringInfo buf, PlannerInfo *root, RelOptInfo *foreignrel,
 					  bool use_alias, List **params_list)
 {
-	RangeTblEntry *rte = planner_rt_fetch(foreignrel->relid, root);
-	
-	/*
-	 * Core code already has some lock on each rel being planned, so we
-	 * can use NoLock here.
-	 */
-	Relation	rel = heap_open(rte->relid, NoLock);
-	
-	Assert(foreignrel->reloptkind != RELOPT_JOINREL);
+	PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) foreignrel->fdw_private;
 
-	vopsDeparseRelation(buf, rel);
-	
-	/*
-	 * Add a unique alias to avoid any conflict in relation names due to
-	 * pulled up subqueries in the query being built for a pushed down
-	 * join.
-	 */
-	if (use_alias)
-		appendStringInfo(buf, " %s%d", REL_ALIAS_PREFIX, foreignrel->relid);
+	if (foreignrel->reloptkind == RELOPT_JOINREL)
+	{
+		StringInfoData join_sql_o;
+		StringInfoData join_sql_i;
+
+		/* Deparse outer relation */
+		initStringInfo(&join_sql_o);
+		deparseFromExprForRel(&join_sql_o, root, fpinfo->outerrel, true, params_list);
+
+		/* Deparse inner relation */
+		initStringInfo(&join_sql_i);
+		deparseFromExprForRel(&join_sql_i, root, fpinfo->innerrel, true, params_list);
+
+		/* Only inner joins are pushed down */
+		appendStringInfo(buf, "(%s INNER JOIN %s ON ", join_sql_o.data, join_sql_i.data);
+
+		if (fpinfo->joinclauses)
+		{
+			deparse_expr_cxt context;
+
+			context.buf = buf;
+			context.foreignrel = foreignrel;
+			context.scanrel = foreignrel;
+			context.root = root;
+			context.params_list = params_list;
+
+			appendStringInfoChar(buf, '(');
+			appendConditions(fpinfo->joinclauses, &context);
+			appendStringInfoChar(buf, ')');
+		}
+		else
+			appendStringInfoString(buf, "(TRUE)");
+
+		/* End the FROM clause entry. */
+		appendStringInfoChar(buf, ')');
+	}
+	else
+	{
+		RangeTblEntry *rte = planner_rt_fetch(foreignrel->relid, root);
 
-	heap_close(rel, NoLock);
+		/*
+		 * Core code already has some lock on each rel being planned, so we
+		 * can use NoLock here.
+		 */
+		Relation	rel = heap_open(rte->relid, NoLock);
+
+		vopsDeparseRelation(buf, rel);
+
+		/*
+		 * Add a unique alias to avoid any conflict in relation names due to
+		 * pulled up subqueries in the query being built for a pushed down
+		 * join.
+		 */
+		if (use_alias)
+			appendStringInfo(buf, " %s%d", REL_ALIAS_PREFIX, foreignrel->relid);
+
+		heap_close(rel, NoLock);
+	}
 }
 
 /*
@@ -1020,6 +1103,7 @@ deparseColumnRef(StringInfo buf, int varno, int varattno, PlannerInfo *root,
 		char	   *colname = NULL;
 		List	   *options;
 		ListCell   *lc;
+		PgFdwRelationInfo *fpinfo;
 
 		/* varno must not be any of OUTER_VAR, INNER_VAR and INDEX_VAR. */
 		Assert(!IS_SPECIAL_VARNO(varno));
@@ -1053,6 +1137,22 @@ deparseColumnRef(StringInfo buf, int varno, int varattno, PlannerInfo *root,
 #else
 			colname = get_relid_attribute_name(rte->relid, varattno);
 #endif
+		/*
+		 * Column which is not present in VOPS table is extracted from its row group
+		 */
+		fpinfo = (PgFdwRelationInfo *) find_base_rel(root, varno)->fdw_private;
+		if (fpinfo != NULL
+			&& bms_is_member(varattno - FirstLowInvalidHeapAttributeNumber, fpinfo->rowgroup_attrs))
+		{
+			appendStringInfoString(buf, "rowgroup_column(");
+			if (qualify_col)
+				ADD_REL_QUALIFIER(buf, varno);
+			appendStringInfo(buf, "%s, ", quote_identifier(fpinfo->rowgroup_name));
+			deparseStringLiteral(buf, colname);
+			appendStringInfo(buf, ", NULL::%s)",
+							 vops_deparse_type_name(vops_get_tile_type(get_atttype(rte->relid, varattno)), -1));
+			return;
+		}
 		if (qualify_col)
 			ADD_REL_QUALIFIER(buf, varno);
 
@@ -1917,6 +2017,53 @@ appendAggOrderBy(List *orderList, List *targetList, deparse_expr_cxt *context)
 	}
 }
 
+/*
+ * Deparse ORDER BY clause of VOPS query. Key tiles of sorted VOPS projection
+ * are not overlapped, so VOPS tuples are ordered by first element of key tile
+ * (or by last element for descending order).
+ */
+static void
+appendOrderByClause(List *pathkeys, deparse_expr_cxt *context)
+{
+	ListCell   *lcell;
+	ListCell   *lc;
+	RelOptInfo *baserel = context->scanrel;
+	StringInfo	buf = context->buf;
+	const char *delim = " ";
+
+	appendStringInfoString(buf, " ORDER BY");
+	foreach(lcell, pathkeys)
+	{
+		PathKey    *pathkey = lfirst(lcell);
+		Expr	   *em_expr = NULL;
+
+		foreach(lc, pathkey->pk_eclass->ec_members)
+		{
+			EquivalenceMember *em = (EquivalenceMember *) lfirst(lc);
+
+			if (!bms_is_empty(em->em_relids)
+				&& bms_is_subset(em->em_relids, baserel->relids))
+			{
+				em_expr = em->em_expr;
+				break;
+			}
+		}
+		Assert(em_expr != NULL);
+
+		appendStringInfoString(buf, delim);
+		appendStringInfoString(buf, VOPS_PATHKEY_DESC(pathkey) ? "last(" : "first(");
+		deparseExpr(em_expr, context);
+		appendStringInfoChar(buf, ')');
+		if (VOPS_PATHKEY_DESC(pathkey))
+			appendStringInfoString(buf, " DESC");
+		if (pathkey->pk_nulls_first)
+			appendStringInfoString(buf, " NULLS FIRST");
+		else
+			appendStringInfoString(buf, " NULLS LAST");
+		delim = ", ";
+	}
+}
+
 /*
  * Print the representation of a parameter to be sent to the remote side.
  *
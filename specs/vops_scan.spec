@@ -0,0 +1,27 @@
+# EvalPlanQual recheck of vector filter of VOPS table
+
+setup
+{
+  CREATE EXTENSION vops;
+  CREATE TABLE e(k integer, x float8);
+  INSERT INTO e SELECT i, i % 10 FROM generate_series(1,128) i;
+  CREATE TABLE ve(k vops_int4, x vops_float8);
+  SELECT populate(destination:='ve'::regclass, source:='e'::regclass, sort:='k');
+}
+
+teardown
+{
+  DROP EXTENSION vops CASCADE;
+  DROP TABLE e;
+}
+
+session s1
+step s1u	{ BEGIN; UPDATE ve SET x = x + 100::float8 WHERE low(k) = 1; }
+step s1c	{ COMMIT; }
+
+session s2
+step s2d	{ DELETE FROM ve WHERE filter(x < 5::float8); }
+step s2s	{ SELECT low(k), high(k) FROM ve; }
+
+# Deleting session waits for the first tile, then rechecks filter on its new version
+permutation s1u s2d s1c s2s
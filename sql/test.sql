@@ -145,3 +145,134 @@ select vquote_refresh();
 
 select first(bid_price,ts),last(ask_size,ts) from vquote group by symbol;
 select symbol,time_bucket('2 minutes',ts) from vquote;
+
+create table rg(data vops_rowgroup);
+select populate(destination:='rg'::regclass, source:='s'::regclass, rowgroup:=array['x']);
+select vops_unnest(rg.*) from rg;
+select sum(rowgroup_column(data, 'x', null::vops_float4)) from rg;
+select rowgroup_low(data, 'x', null::real), rowgroup_high(data, 'x', null::real) from rg;
+
+create table n(price numeric(10,2));
+insert into n values (1.25),(2.5),(null),(3.333);
+create table vn(price vops_numeric(10,2));
+select populate(destination:='vn'::regclass, source:='n'::regclass);
+select sum(price),avg(price),min(price),max(price),count(price) from vn;
+
+create table tz(ts timestamptz);
+insert into tz values ('2018-03-25 00:30:00+00'),('2018-03-25 01:30:00+00'),('2018-03-25 23:30:00+00');
+select create_projection('vtz','tz',array['ts']);
+select vtz_refresh();
+set timezone='UTC';
+select low(time_bucket('1 day',ts,'Europe/Berlin')),high(time_bucket('1 day',ts,'Europe/Berlin')) from vtz;
+reset timezone;
+select date_part('month',ts),date_part('dow',ts),date_part('hour',ts) from vquote;
+select time_bucket('3 months',ts) from vquote;
+select sum(case when ask_size > 110 then bid_size else 0::vops_int4 end),sum(case when ask_size > 110 then bid_size end) from vquote;
+select sum(greatest(ask_size,110::vops_int4)),sum(least(ask_size,bid_size)),sum(floor(bid_price)),sum(ceil(ask_price)) from vquote;
+select sum(ask_size * bid_size::vops_float8),sum(ask_size::vops_int2),max(ts::vops_date) from vquote;
+select length(vops_int4_send(ask_size)),length(vops_float4_send(bid_price)),length(vops_bool_send(ask_size > 110)) from vquote;
+create table vit_copy (like vit);
+\getenv abs_builddir PG_ABS_BUILDDIR
+\set filename :abs_builddir '/results/vops_vit.bin'
+copy vit to :'filename' with (format binary);
+copy vit_copy from :'filename' with (format binary);
+select * from vit_copy;
+create table vn_copy (like vn);
+\set filename :abs_builddir '/results/vops_vn.bin'
+copy vn to :'filename' with (format binary);
+copy vn_copy from :'filename' with (format binary);
+select sum(price),min(price),max(price),count(price) from vn_copy;
+select * from tile_cache_stats();
+create table wt(id integer, t varchar(64));
+insert into wt select i, repeat(chr(97 + i % 3), 60) from generate_series(1,100) i;
+create table vwt(id vops_int4, t vops_text(64));
+select populate(destination:='vwt'::regclass, source:='wt'::regclass);
+select count(*) from vwt where t = repeat('b',60);
+select count(*),sum(id) from vwt where t = repeat('c',60);
+select count(*) from vwt where t >= repeat('b',60) and t <= repeat('b',60) and t <> repeat('a',60);
+select count(*),min(id),max(id) from vwt where t > repeat('a',60) and t < repeat('c',60);
+select vops_unnest(vit.*) from vit where t <> 'min'::text;
+select count(*) from (select vops_unnest(v2.*) from v2 where x > 50) u;
+select count(*) from (select vops_unnest(vwt.*) from vwt where t = repeat('b',60)) u;
+create table ord(id integer, val real);
+insert into ord select i, i*0.5 from generate_series(1,200) i;
+select create_projection('vord','ord',array['id','val'],order_by:='id');
+select vord_refresh();
+create foreign table ord_fdw(id integer, val real) server vops_server options (table_name 'vord');
+select id, val from ord_fdw where id > 195;
+select count(*) from (select id from ord_fdw where id > 0 offset 0) s;
+explain (verbose, costs off) select id, val from ord_fdw;
+select count(*), sum(id), max(val) from (select id, val from ord_fdw offset 0) s;
+explain (verbose, costs off) select id, val from ord_fdw where id > 195 and val <= 99;
+select id, val from ord_fdw where id > 195 and val <= 99;
+select val from ord_fdw where id between 10 and 12;
+create foreign table ord_renamed(key integer options (column_name 'id'), val real) server vops_server options (table_name 'vord');
+select key, val from ord_renamed limit 3;
+set parallel_setup_cost=0;
+set parallel_tuple_cost=0;
+set min_parallel_table_scan_size=0;
+explain (costs off) select count(*), sum(id) from (select id from ord_fdw offset 0) s;
+select count(*), sum(id) from (select id from ord_fdw offset 0) s;
+reset min_parallel_table_scan_size;
+reset parallel_tuple_cost;
+reset parallel_setup_cost;
+create foreign table stock_fdw(symbol char(5), day date, low real, high real, open real, close real) server vops_server options (table_name 'vstock');
+create table company(symbol char(5), name text);
+insert into company values ('AAA','AAA Inc'),('BBB','BBB Ltd');
+create foreign table company_fdw(symbol char(5), name text) server vops_server options (table_name 'company');
+explain (costs off) select name, day, close from stock_fdw join company_fdw on stock_fdw.symbol = company_fdw.symbol where close > 11 order by day;
+select name, day, close from stock_fdw join company_fdw on stock_fdw.symbol = company_fdw.symbol where close > 11 order by day;
+explain (costs off) select id, val from ord_fdw order by id desc limit 3;
+select id, val from ord_fdw order by id desc limit 3;
+show vops.tile_operator_cost;
+show vops.tile_aggregate_cost;
+show vops.unnest_row_cost;
+explain (costs off) select count(*), sum(id), max(val) from ord_fdw;
+select count(*), sum(id), max(val) from ord_fdw;
+set vops.tile_aggregate_cost=1000;
+explain (costs off) select count(*), sum(id), max(val) from ord_fdw;
+reset vops.tile_aggregate_cost;
+analyze ord_fdw;
+select attname, null_frac, n_distinct from pg_stats where tablename = 'ord_fdw' order by attname;
+select reltuples from pg_class where relname = 'ord_fdw';
+create table big(k integer, r integer);
+insert into big select i, (i*7919) % 1000 from generate_series(1,6400) i;
+create table vbig(k vops_int4, r vops_int4);
+select populate(destination:='vbig'::regclass, source:='big'::regclass, sort:='k');
+analyze vbig;
+select attname, n_distinct, correlation from pg_stats where tablename = 'vbig' and attname = 'k';
+create function plan_rows(query text) returns integer as $$ declare plan text; begin execute 'explain ' || query into plan; return substring(plan from 'rows=(\d+)')::integer; end; $$ language plpgsql;
+select plan_rows('select * from vbig where k < 640'), plan_rows('select * from vbig');
+select plan_rows('select vops_unnest(vbig.*) from vbig where k < 640'), plan_rows('select vops_unnest(vbig.*) from vbig');
+explain (costs off) select count(*) from vbig where (k >= 100) & (k < 640);
+select count(*) from vbig where (k >= 100) & (k < 640);
+set vops.enable_vops_scan=off;
+select count(*) from vbig where (k >= 100) & (k < 640);
+reset vops.enable_vops_scan;
+create table nf(k integer, x float8, y real);
+insert into nf select i, case when i % 5 = 0 then null else i % 10 end, case when i % 7 = 0 then null else i % 10 + 0.5 end from generate_series(1,640) i;
+create table vnf(k vops_int4, x vops_float8, y vops_float4);
+select populate(destination:='vnf'::regclass, source:='nf'::regclass, sort:='k');
+explain (costs off) select count(*) from vnf where (!(x > 5::float8)) | betwixt(y, 2.5::float8, 4.5::float8);
+select count(*) from vnf where !(x > 5::float8);
+select count(*) from vnf where (x < 2::float8) | (y > 8::float4);
+select count(*) from vnf where betwixt(y, 2.5::float8, 4.5::float8);
+select count(*) from vnf where (!(x > 5::float8)) | betwixt(y, 2.5::float8, 4.5::float8);
+set vops.enable_vops_scan=off;
+select count(*) from vnf where !(x > 5::float8);
+select count(*) from vnf where (x < 2::float8) | (y > 8::float4);
+select count(*) from vnf where betwixt(y, 2.5::float8, 4.5::float8);
+select count(*) from vnf where (!(x > 5::float8)) | betwixt(y, 2.5::float8, 4.5::float8);
+reset vops.enable_vops_scan;
+create table dim(id integer primary key, weight float8 not null);
+insert into dim select i, i*0.5 from generate_series(1,100) i;
+select count(*), sum(vops_lookup('dim','id',k,'weight',null::vops_float8)) from vbig where k <= 200;
+select count(*) from vbig where filter(is_not_null(vops_lookup('dim','id',k,'weight',null::vops_float8)));
+select count(*) from vbig where filter(vops_in(k, array(select id from dim where id % 10 = 0)));
+select count(*) from vbig where filter(vops_in(k, array[1,null,3]));
+select sum(val) from ord where id in (select id from dim where id <= 10);
+prepare q(integer) as select sum(val) from ord where id <= $1;
+explain (costs off) execute q(10);
+execute q(10);
+execute q(100);
+deallocate q;
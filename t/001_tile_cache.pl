@@ -0,0 +1,106 @@
+# Copyright (c) 2025, Postgres Professional
+
+# Shared cache of detoasted tiles: hits, eviction and invalidation
+use strict;
+use warnings;
+
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+my $node = PostgreSQL::Test::Cluster->new('main');
+$node->init;
+# 64kB is 8 slots
+$node->append_conf(
+	'postgresql.conf', qq{
+shared_preload_libraries = 'vops'
+vops.tile_cache_size = 64kB
+});
+$node->start;
+
+$node->safe_psql('postgres', 'create extension vops');
+
+# md5 strings are not compressible, so 64 of them are moved to TOAST as is
+$node->safe_psql(
+	'postgres', q{
+create table small(id integer, t varchar(96));
+insert into small select i, repeat(md5(i::text), 3) from generate_series(1,256) i;
+create table vsmall(id vops_int4, t vops_text(96));
+select populate(destination:='vsmall'::regclass, source:='small'::regclass);
+create table big(id integer, t varchar(96));
+insert into big select i, repeat(md5(i::text), 3) from generate_series(1,1280) i;
+create table vbig(id vops_int4, t vops_text(96));
+select populate(destination:='vbig'::regclass, source:='big'::regclass);
+create table packed(id integer, t varchar(64));
+insert into packed select i, repeat(chr(97 + i % 3), 60) from generate_series(1,256) i;
+create table vpacked(id vops_int4, t vops_text(64));
+select populate(destination:='vpacked'::regclass, source:='packed'::regclass);
+});
+
+sub stats
+{
+	my @s = split /\|/,
+	  $node->safe_psql('postgres',
+		'select hits, misses, used_slots, total_slots from tile_cache_stats()');
+	return @s;
+}
+
+is((stats())[3], 8, 'number of slots');
+
+# Tiles stored in TOAST
+is($node->safe_psql('postgres', q{select count(*) from vsmall where t <> ''::text}),
+	'256', 'first scan of TOASTed tiles');
+my ($hits, $misses) = stats();
+is($hits, 0, 'no hits on the first scan');
+cmp_ok($misses, '>=', 4, 'tiles are loaded on the first scan');
+
+is($node->safe_psql('postgres', q{select count(*) from vsmall where t <> ''::text}),
+	'256', 'second scan of TOASTed tiles');
+my ($hits2, $misses2) = stats();
+cmp_ok($hits2, '>=', 4, 'tiles are taken from the cache by another backend');
+is($misses2, $misses, 'no misses on the second scan');
+
+# Tiles compressed inline
+is( $node->safe_psql('postgres',
+		q{select count(*) from vpacked where t = repeat('b',60)}),
+	'86',
+	'first scan of compressed tiles');
+($hits, $misses) = stats();
+is( $node->safe_psql('postgres',
+		q{select count(*) from vpacked where t = repeat('b',60)}),
+	'86',
+	'second scan of compressed tiles');
+($hits2, $misses2) = stats();
+cmp_ok($hits2 - $hits, '>=', 4, 'compressed tiles are taken from the cache');
+is($misses2, $misses, 'compressed tiles are not loaded again');
+
+# 20 tiles do not fit in 8 slots
+is($node->safe_psql('postgres', q{select count(*) from vbig where t <> ''::text}),
+	'1280', 'first scan of large table');
+($hits, $misses) = stats();
+is((stats())[2], 8, 'all slots are used');
+is($node->safe_psql('postgres', q{select count(*) from vbig where t <> ''::text}),
+	'1280', 'second scan of large table');
+($hits2, $misses2) = stats();
+cmp_ok($misses2 - $misses, '>', 0, 'evicted tiles are loaded again');
+
+# Tiles of truncated table are not returned
+$node->safe_psql('postgres', q{select count(*) from vsmall where t <> ''::text});
+$node->safe_psql(
+	'postgres', q{
+truncate vsmall;
+update small set t = repeat(md5((-id)::text), 3);
+select populate(destination:='vsmall'::regclass, source:='small'::regclass);
+});
+is( $node->safe_psql('postgres',
+		q{select count(*) from vsmall where t = repeat(md5('-7'), 3)}),
+	'1',
+	'new content is seen after truncate');
+is( $node->safe_psql('postgres',
+		q{select count(*) from vsmall where t = repeat(md5('7'), 3)}),
+	'0',
+	'old content is not seen after truncate');
+
+$node->stop;
+
+done_testing();
@@ -0,0 +1,1102 @@
+/* contrib/vops/vops--1.1--1.2.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "ALTER EXTENSION vops UPDATE TO '1.2'" to load this file. \quit
+
+create type vops_numeric;
+create type vops_timestamptz;
+
+create function vops_numeric_input(cstring, oid, integer) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_output(vops_numeric) returns cstring as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_timestamptz_input(cstring) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_input' language C parallel safe immutable strict;
+create function vops_timestamptz_output(vops_timestamptz) returns cstring as 'MODULE_PATHNAME','vops_int8_output' language C parallel safe immutable strict;
+create function vops_bool_send(vops_bool) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_bool_recv(internal) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_char_send(vops_char) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_char_recv(internal) returns vops_char as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int2_send(vops_int2) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int2_recv(internal) returns vops_int2 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int4_send(vops_int4) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int4_recv(internal) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int8_send(vops_int8) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_int8_recv(internal) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_float4_send(vops_float4) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_float4_recv(internal) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_float8_send(vops_float8) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_float8_recv(internal) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_date_send(vops_date) returns bytea as 'MODULE_PATHNAME','vops_int4_send' language C parallel safe immutable strict;
+create function vops_date_recv(internal) returns vops_date as 'MODULE_PATHNAME','vops_int4_recv' language C parallel safe immutable strict;
+create function vops_timestamp_send(vops_timestamp) returns bytea as 'MODULE_PATHNAME','vops_int8_send' language C parallel safe immutable strict;
+create function vops_timestamp_recv(internal) returns vops_timestamp as 'MODULE_PATHNAME','vops_int8_recv' language C parallel safe immutable strict;
+create function vops_timestamptz_send(vops_timestamptz) returns bytea as 'MODULE_PATHNAME','vops_int8_send' language C parallel safe immutable strict;
+create function vops_timestamptz_recv(internal) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_recv' language C parallel safe immutable strict;
+create function vops_interval_send(vops_interval) returns bytea as 'MODULE_PATHNAME','vops_int8_send' language C parallel safe immutable strict;
+create function vops_interval_recv(internal) returns vops_interval as 'MODULE_PATHNAME','vops_int8_recv' language C parallel safe immutable strict;
+create function vops_text_send(vops_text) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_text_recv(internal, oid, integer) returns vops_text as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_send(vops_numeric) returns bytea as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_recv(internal, oid, integer) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_typanalyze(internal) returns bool as 'MODULE_PATHNAME' language C strict;
+
+create type vops_numeric (
+	input = vops_numeric_input,
+	output = vops_numeric_output,
+	receive = vops_numeric_recv,
+	send = vops_numeric_send,
+	analyze = vops_typanalyze,
+	typmod_in = numerictypmodin,
+	typmod_out = numerictypmodout,
+	alignment = double,
+	internallength = 536 -- 16 + 64*8 + 8
+);
+
+create type vops_timestamptz (
+	input = vops_timestamptz_input,
+	output = vops_timestamptz_output,
+	receive = vops_timestamptz_recv,
+	send = vops_timestamptz_send,
+	analyze = vops_typanalyze,
+	alignment = double,
+	internallength = 528 -- 16 + 64*8
+);
+
+-- Binary I/O can be attached to existing types only by ALTER TYPE, which
+-- is available since PostgreSQL 13. On older servers tile types created by
+-- version 1.1 keep text I/O only.
+do $$
+declare
+	typ text;
+begin
+	if current_setting('server_version_num')::integer >= 130000 then
+		foreach typ in array array['bool','char','int2','int4','date','int8','float4','float8','timestamp','interval','text']
+		loop
+			execute format('alter type vops_%s set (receive = vops_%s_recv, send = vops_%s_send)', typ, typ, typ);
+		end loop;
+	end if;
+end $$;
+
+-- Element statistics of existing tile types (PostgreSQL 13 and newer, see above)
+do $$
+declare
+	typ text;
+begin
+	if current_setting('server_version_num')::integer >= 130000 then
+		foreach typ in array array['char','int2','int4','date','int8','float4','float8','timestamp','text']
+		loop
+			execute format('alter type vops_%s set (analyze = vops_typanalyze)', typ);
+		end loop;
+	end if;
+end $$;
+
+drop function populate(regclass, regclass, cstring, cstring);
+create function populate(destination regclass, source regclass, predicate cstring default null, sort cstring default null, rowgroup text[] default null) returns bigint as 'MODULE_PATHNAME','vops_populate' language C;
+
+-- Row group: tiles of several columns packed in one datum
+
+create type vops_rowgroup;
+create function vops_rowgroup_input(cstring) returns vops_rowgroup as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_rowgroup_output(vops_rowgroup) returns cstring as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create type vops_rowgroup (
+	input = vops_rowgroup_input,
+	output = vops_rowgroup_output,
+	alignment = double,
+	storage = external -- no compression: column chunks can be fetched separately
+);
+
+create function rowgroup_column(rowgroup vops_rowgroup, column_name text, tile anyelement) returns anyelement as 'MODULE_PATHNAME','vops_rowgroup_get_column' language C parallel safe immutable;
+
+create function rowgroup_low(rowgroup vops_rowgroup, column_name text, result anyelement) returns anyelement as 'MODULE_PATHNAME','vops_rowgroup_low' language C parallel safe immutable;
+create function rowgroup_high(rowgroup vops_rowgroup, column_name text, result anyelement) returns anyelement as 'MODULE_PATHNAME','vops_rowgroup_high' language C parallel safe immutable;
+
+-- Shared tile cache
+
+create function tile_cache_stats(out hits bigint, out misses bigint, out hit_ratio float8, out used_slots integer, out total_slots integer) returns record as 'MODULE_PATHNAME','vops_tile_cache_stats' language C;
+
+-- numeric tile
+
+create function vops_numeric(tile vops_numeric, typmod integer) returns vops_numeric as 'MODULE_PATHNAME','vops_numeric_typmod' language C parallel safe immutable strict;
+create cast (vops_numeric as vops_numeric) with function vops_numeric(vops_numeric, integer) as implicit;
+
+create function vops_numeric_const(opd numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (numeric as vops_numeric) with function vops_numeric_const(numeric);
+
+create function vops_numeric_sub(left vops_numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_sub_rconst(left vops_numeric, right numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_sub_lconst(left numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_sub);
+create operator - (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_sub_rconst);
+create operator - (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_sub_lconst);
+
+create function vops_numeric_add(left vops_numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_add_rconst(left vops_numeric, right numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_add_lconst(left numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_add, commutator= +);
+create operator + (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_add_rconst, commutator= +);
+create operator + (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_add_lconst, commutator= +);
+
+create function vops_numeric_mul(left vops_numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_mul_rconst(left vops_numeric, right numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_mul_lconst(left numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_mul, commutator= *);
+create operator * (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_mul_rconst, commutator= *);
+create operator * (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_mul_lconst, commutator= *);
+
+create function vops_numeric_eq(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_eq_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_eq_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator = (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_eq, commutator= =);
+create operator = (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_eq_rconst, commutator= =);
+create operator = (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_eq_lconst, commutator= =);
+
+create function vops_numeric_ne(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_ne_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_ne_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator <> (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_ne, commutator= <>);
+create operator <> (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_ne_rconst, commutator= <>);
+create operator <> (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_ne_lconst, commutator= <>);
+
+create function vops_numeric_gt(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_gt_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_gt_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator > (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_gt, commutator= <);
+create operator > (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_gt_rconst, commutator= <);
+create operator > (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_gt_lconst, commutator= <);
+
+create function vops_numeric_lt(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_lt_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_lt_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator < (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_lt, commutator= >);
+create operator < (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_lt_rconst, commutator= >);
+create operator < (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_lt_lconst, commutator= >);
+
+create function vops_numeric_ge(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_ge_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_ge_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator >= (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_ge, commutator= <=);
+create operator >= (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_ge_rconst, commutator= <=);
+create operator >= (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_ge_lconst, commutator= <=);
+
+create function vops_numeric_le(left vops_numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_le_rconst(left vops_numeric, right numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create function vops_numeric_le_lconst(left numeric, right vops_numeric) returns vops_bool as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator <= (leftarg=vops_numeric, rightarg=vops_numeric, procedure=vops_numeric_le, commutator= >=);
+create operator <= (leftarg=vops_numeric, rightarg=numeric, procedure=vops_numeric_le_rconst, commutator= >=);
+create operator <= (leftarg=numeric, rightarg=vops_numeric, procedure=vops_numeric_le_lconst, commutator= >=);
+
+create function betwixt(opd vops_numeric, low numeric, high numeric) returns vops_bool as 'MODULE_PATHNAME','vops_betwixt_numeric' language C parallel safe immutable strict;
+
+create function ifnull(opd vops_numeric, subst numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_ifnull_numeric' language C parallel safe immutable strict;
+create function ifnull(opd vops_numeric, subst vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_coalesce_numeric' language C parallel safe immutable strict;
+
+create function vops_numeric_neg(right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (rightarg=vops_numeric, procedure=vops_numeric_neg);
+
+create function vops_numeric_sum_accumulate(state internal, val vops_numeric) returns internal as 'MODULE_PATHNAME' language C parallel safe;
+create function vops_numeric_sum_combine(state0 internal, state1 internal) returns internal as 'MODULE_PATHNAME' language C parallel safe;
+create function vops_numeric_sum_serial(state internal) returns bytea as 'MODULE_PATHNAME' language C parallel safe strict;
+create function vops_numeric_sum_deserial(serial bytea, dummy internal) returns internal as 'MODULE_PATHNAME' language C parallel safe strict;
+create function vops_numeric_sum_final(state internal) returns numeric as 'MODULE_PATHNAME' language C parallel safe strict;
+create function vops_numeric_avg_final(state internal) returns numeric as 'MODULE_PATHNAME' language C parallel safe strict;
+create aggregate sum(vops_numeric) (
+	sfunc = vops_numeric_sum_accumulate,
+	stype = internal,
+	finalfunc = vops_numeric_sum_final,
+	combinefunc = vops_numeric_sum_combine,
+	serialfunc = vops_numeric_sum_serial,
+	deserialfunc = vops_numeric_sum_deserial,
+	parallel = safe
+);
+
+create aggregate avg(vops_numeric) (
+	sfunc = vops_numeric_sum_accumulate,
+	stype = internal,
+	finalfunc = vops_numeric_avg_final,
+	combinefunc = vops_numeric_sum_combine,
+	serialfunc = vops_numeric_sum_serial,
+	deserialfunc = vops_numeric_sum_deserial,
+	parallel = safe
+);
+
+create function vops_numeric_max_accumulate(state numeric, val vops_numeric) returns numeric as 'MODULE_PATHNAME' language C parallel safe;
+create aggregate max(vops_numeric) (
+	sfunc = vops_numeric_max_accumulate,
+	stype = numeric,
+	combinefunc = numeric_larger,
+	parallel = safe
+);
+
+create function vops_numeric_min_accumulate(state numeric, val vops_numeric) returns numeric as 'MODULE_PATHNAME' language C parallel safe;
+create aggregate min(vops_numeric) (
+	sfunc = vops_numeric_min_accumulate,
+	stype = numeric,
+	combinefunc = numeric_smaller,
+	parallel = safe
+);
+
+create function vops_numeric_count_accumulate(state int8, val vops_numeric) returns int8 as 'MODULE_PATHNAME','vops_count_any_accumulate' language C parallel safe strict;
+create aggregate count(vops_numeric) (
+	sfunc = vops_numeric_count_accumulate,
+	stype = int8,
+	combinefunc = int8pl,
+	INITCOND = '0',
+	parallel = safe
+);
+
+create function vops_numeric_count_extend(state vops_int8, val vops_numeric) returns vops_int8 as 'MODULE_PATHNAME','vops_count_any_extend' language C parallel safe strict;
+create function vops_numeric_count_reduce(state vops_int8, val vops_numeric) returns vops_int8 as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe strict;
+create aggregate mcount(vops_numeric) (
+	sfunc = vops_numeric_count_extend,
+	stype = vops_int8,
+	initcond = '0',
+	mstype = vops_int8,
+	msfunc = vops_numeric_count_extend,
+	minvfunc = vops_numeric_count_reduce,
+	minitcond = '0',
+	parallel = safe
+);
+
+create function vops_numeric_sum_extend(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe;
+create function vops_numeric_sum_reduce(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate msum(vops_numeric) (
+	sfunc = vops_numeric_sum_extend,
+	stype = vops_numeric,
+	mstype = vops_numeric,
+	msfunc = vops_numeric_sum_extend,
+	minvfunc = vops_numeric_sum_reduce,
+	parallel = safe
+);
+
+create function vops_numeric_max_extend(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe;
+create function vops_numeric_max_reduce(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate mmax(vops_numeric) (
+	sfunc = vops_numeric_max_extend,
+	stype = vops_numeric,
+	mstype = vops_numeric,
+	msfunc = vops_numeric_max_extend,
+	minvfunc = vops_numeric_max_reduce,
+	parallel = safe
+);
+
+create function vops_numeric_min_extend(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME' language C parallel safe;
+create function vops_numeric_min_reduce(state vops_numeric, val vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate mmin(vops_numeric) (
+	sfunc = vops_numeric_min_extend,
+	stype = vops_numeric,
+	mstype = vops_numeric,
+	msfunc = vops_numeric_min_extend,
+	minvfunc = vops_numeric_min_reduce,
+	parallel = safe
+);
+
+create function first(tile vops_numeric) returns numeric as 'MODULE_PATHNAME','vops_numeric_first' language C parallel safe immutable strict;
+create function last(tile vops_numeric) returns numeric as 'MODULE_PATHNAME','vops_numeric_last' language C parallel safe immutable strict;
+create function low(tile vops_numeric) returns numeric as 'MODULE_PATHNAME','vops_numeric_low' language C parallel safe immutable strict;
+create function high(tile vops_numeric) returns numeric as 'MODULE_PATHNAME','vops_numeric_high' language C parallel safe immutable strict;
+
+create or replace function create_projection(projection_name text, source_table regclass, vector_columns text[], scalar_columns text[] default null, order_by text default null) returns void as $create$
+declare
+	create_table text;
+	create_func  text;
+	create_index text;
+	vector_attno integer[];
+	scalar_attno integer[];
+	att_num      integer;
+	att_name     text;
+	att_typname  text;
+	att_typid    integer;
+	sep          text := '';
+	key_type     text;
+	min_value    text;
+	i            integer;
+	att_typmod   integer;
+ begin
+	create_table := 'create table '||projection_name||'(';
+	create_func := 'create function '||projection_name||'_refresh() returns bigint as $$ select populate(source:='''||source_table::text||''', destination:='''||projection_name||''', sort:=''';
+	if scalar_columns is not null
+	then
+		create_index := 'create index on '||projection_name||' using brin(';
+		foreach att_name IN ARRAY scalar_columns
+		loop
+			select atttypid, attnum, typname into att_typid, att_num, att_typname from pg_attribute, pg_type where attrelid=source_table::oid and attname=att_name and atttypid=pg_type.oid;
+		if att_typid is null
+			then
+				raise exception 'No attribute % in table %', att_name, source_table;
+			end if;
+			scalar_attno := scalar_attno||att_num;
+			if att_typname='char'
+			then
+				att_typname:='"char"';
+			end if;
+			create_table := create_table||sep||att_name||' '||att_typname;
+			create_func := create_func||sep||att_name;
+			create_index := create_index||sep||att_name;
+			sep := ',';
+		end loop;
+	end if;
+
+	if order_by is not null
+	then
+		create_func := create_func||sep||order_by;
+	end if;
+	create_func := create_func||''''; -- end of sort list
+
+	foreach att_name in array vector_columns
+	loop
+		select atttypid, attnum, typname, atttypmod into att_typid, att_num, att_typname, att_typmod from pg_attribute, pg_type where attrelid=source_table::oid and attname=att_name and atttypid=pg_type.oid;
+		if att_typid is null
+		then
+			raise exception 'No attribute % in table %', att_name, source_table;
+		end if;
+		if att_typname='bpchar' or att_typname='varchar'
+		then
+			att_typname:='text('||(att_typmod-4)||')';
+		elsif att_typname='numeric'
+		then
+			att_typname:=format_type(att_typid, att_typmod);
+		end if;
+		vector_attno := vector_attno||att_num;
+		create_table := create_table||sep||att_name||' vops_'||att_typname;
+		sep := ',';
+		if att_name=order_by
+		then
+			key_type := att_typname;
+		end if;
+	end loop;
+
+	create_table := create_table||')';
+	execute create_table;
+
+	if create_index is not null
+	then
+		create_index := create_index||')';
+		execute create_index;
+	end if;
+
+	if order_by is not null
+	then
+		if key_type is null
+		then
+			raise exception 'Invalid order column % for projection %', order_by, projection_name;
+		end if;
+		create_index := 'create index on '||projection_name||' using brin(first('||order_by||'))';
+		execute create_index;
+		create_index := 'create index on '||projection_name||' using brin(last('||order_by||'))';
+		execute create_index;
+		if key_type='timestamp' or key_type='date'
+		then
+			min_value := '''''-infinity''''::'||key_type;
+		else
+			min_value := '-1'; -- assume that key have only non-negative values
+		end if;
+		create_func := create_func||', predicate:='''||order_by||'>(select coalesce(max(last('||order_by||')),'||min_value||') from '||projection_name||')''';
+	end if;
+	create_func := create_func||'); $$ language sql';
+	execute create_func;
+
+	insert into vops_projections values (projection_name, source_table, vector_attno, scalar_attno, order_by);
+end;
+$create$ language plpgsql;
+
+-- timestamptz tile
+
+create function time_bucket(interval, vops_timestamptz) returns vops_timestamptz  as 'MODULE_PATHNAME','vops_time_bucket_tz' language C parallel safe stable strict;
+create function time_bucket(interval, vops_timestamptz, timezone text) returns vops_timestamptz  as 'MODULE_PATHNAME','vops_time_bucket_tz' language C parallel safe immutable strict;
+create function date_bucket(interval, vops_timestamptz) returns vops_date  as 'MODULE_PATHNAME','vops_date_bucket_tz' language C parallel safe stable strict;
+create function date_bucket(interval, vops_timestamptz, timezone text) returns vops_date  as 'MODULE_PATHNAME','vops_date_bucket_tz' language C parallel safe immutable strict;
+
+create function vops_timestamptz_const(opd timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_const' language C parallel safe immutable strict;
+create cast (timestamptz as vops_timestamptz) with function vops_timestamptz_const(timestamptz);
+
+create function vops_timestamptz_group_by(state internal, group_by vops_timestamptz, aggregates cstring, variadic anyarray) returns internal as 'MODULE_PATHNAME','vops_int8_group_by' language C immutable;
+create aggregate map(group_by vops_timestamptz, aggregates cstring, variadic anyarray) (
+	sfunc = vops_timestamptz_group_by,
+	stype = internal,
+	finalfunc=vops_agg_final,
+	combinefunc = vops_agg_combine,
+	serialfunc = vops_agg_serial,
+	deserialfunc = vops_agg_deserial,
+	parallel = safe);
+
+create function vops_timestamptz_sub(left vops_timestamptz, right vops_timestamptz) returns vops_interval as 'MODULE_PATHNAME','vops_int8_sub' language C parallel safe immutable strict;
+create function vops_timestamptz_interval_sub(left vops_timestamptz, right vops_interval) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_sub' language C parallel safe immutable strict;
+create function vops_timestamptz_sub_rconst(left vops_timestamptz, right timestamptz) returns vops_interval as 'MODULE_PATHNAME','vops_int8_sub_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_sub_lconst(left timestamptz, right vops_timestamptz) returns vops_interval as 'MODULE_PATHNAME','vops_int8_sub_lconst' language C parallel safe immutable strict;
+create function vops_timestamptz_sub_interval_rconst(left vops_timestamptz, right deltatime) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_sub_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_sub_interval_lconst(left timestamptz, right vops_interval) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_sub_lconst' language C parallel safe immutable strict;
+create operator - (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_sub);
+create operator - (leftarg=vops_timestamptz, rightarg=vops_interval, procedure=vops_timestamptz_interval_sub);
+create operator - (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_sub_rconst);
+create operator - (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_sub_lconst);
+create operator - (leftarg=vops_timestamptz, rightarg=deltatime, procedure=vops_timestamptz_sub_interval_rconst);
+create operator - (leftarg=timestamptz, rightarg=vops_interval, procedure=vops_timestamptz_sub_interval_lconst);
+
+create function vops_timestamptz_interval_add(left vops_timestamptz, right vops_interval) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_add' language C parallel safe immutable strict;
+create function vops_interval_timestamptz_add(left vops_interval, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_add' language C parallel safe immutable strict;
+create function vops_timestamptz_add_rconst(left vops_timestamptz, right deltatime) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_add_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_add_lconst(left deltatime, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_add_lconst' language C parallel safe immutable strict;
+create operator + (leftarg=vops_timestamptz, rightarg=vops_interval, procedure=vops_timestamptz_interval_add, commutator= +);
+create operator + (leftarg=vops_interval, rightarg=vops_timestamptz, procedure=vops_interval_timestamptz_add, commutator= +);
+create operator + (leftarg=vops_timestamptz, rightarg=deltatime, procedure=vops_timestamptz_add_rconst, commutator= +);
+create operator + (leftarg=deltatime, rightarg=vops_timestamptz, procedure=vops_timestamptz_add_lconst, commutator= +);
+
+create function vops_timestamptz_mul(left vops_timestamptz, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_mul' language C parallel safe immutable strict;
+create function vops_timestamptz_mul_rconst(left vops_timestamptz, right timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_mul_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_mul_lconst(left timestamptz, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_mul_lconst' language C parallel safe immutable strict;
+create operator * (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_mul, commutator= *);
+create operator * (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_mul_rconst, commutator= *);
+create operator * (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_mul_lconst, commutator= *);
+
+create function vops_timestamptz_div(left vops_timestamptz, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_div' language C parallel safe immutable strict;
+create function vops_timestamptz_div_rconst(left vops_timestamptz, right int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_div_rconst' language C parallel safe immutable strict;
+create operator / (leftarg=vops_timestamptz, rightarg=vops_int8, procedure=vops_timestamptz_div);
+create operator / (leftarg=vops_timestamptz, rightarg=int8, procedure=vops_timestamptz_div_rconst);
+
+create function vops_timestamptz_rem(left vops_timestamptz, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_rem' language C parallel safe immutable strict;
+create function vops_timestamptz_rem_rconst(left vops_timestamptz, right int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_rem_rconst' language C parallel safe immutable strict;
+create operator % (leftarg=vops_timestamptz, rightarg=vops_int8, procedure=vops_timestamptz_rem);
+create operator % (leftarg=vops_timestamptz, rightarg=int8, procedure=vops_timestamptz_rem_rconst);
+
+create function vops_timestamptz_eq(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_eq' language C parallel safe immutable strict;
+create function vops_timestamptz_eq_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_eq_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_eq_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_eq_lconst' language C parallel safe immutable strict;
+create operator = (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_eq, commutator= =);
+create operator = (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_eq_rconst, commutator= =);
+create operator = (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_eq_lconst, commutator= =);
+
+create function vops_timestamptz_ne(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ne' language C parallel safe immutable strict;
+create function vops_timestamptz_ne_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ne_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_ne_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ne_lconst' language C parallel safe immutable strict;
+create operator <> (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_ne, commutator= <>);
+create operator <> (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_ne_rconst, commutator= <>);
+create operator <> (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_ne_lconst, commutator= <>);
+
+create function vops_timestamptz_gt(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_gt' language C parallel safe immutable strict;
+create function vops_timestamptz_gt_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_gt_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_gt_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_gt_lconst' language C parallel safe immutable strict;
+create operator > (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_gt, commutator= <);
+create operator > (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_gt_rconst, commutator= <);
+create operator > (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_gt_lconst, commutator= <);
+
+create function vops_timestamptz_lt(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_lt' language C parallel safe immutable strict;
+create function vops_timestamptz_lt_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_lt_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_lt_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_lt_lconst' language C parallel safe immutable strict;
+create operator < (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_lt, commutator= >);
+create operator < (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_lt_rconst, commutator= >);
+create operator < (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_lt_lconst, commutator= >);
+
+create function vops_timestamptz_ge(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ge' language C parallel safe immutable strict;
+create function vops_timestamptz_ge_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ge_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_ge_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_ge_lconst' language C parallel safe immutable strict;
+create operator >= (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_ge, commutator= <=);
+create operator >= (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_ge_rconst, commutator= <=);
+create operator >= (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_ge_lconst, commutator= <=);
+
+create function vops_timestamptz_le(left vops_timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_le' language C parallel safe immutable strict;
+create function vops_timestamptz_le_rconst(left vops_timestamptz, right timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_le_rconst' language C parallel safe immutable strict;
+create function vops_timestamptz_le_lconst(left timestamptz, right vops_timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_int8_le_lconst' language C parallel safe immutable strict;
+create operator <= (leftarg=vops_timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_le, commutator= >=);
+create operator <= (leftarg=vops_timestamptz, rightarg=timestamptz, procedure=vops_timestamptz_le_rconst, commutator= >=);
+create operator <= (leftarg=timestamptz, rightarg=vops_timestamptz, procedure=vops_timestamptz_le_lconst, commutator= >=);
+
+create function betwixt(opd vops_timestamptz, low timestamptz, high timestamptz) returns vops_bool as 'MODULE_PATHNAME','vops_betwixt_int8' language C parallel safe immutable strict;
+
+create function ifnull(opd vops_timestamptz, subst timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_ifnull_int8' language C parallel safe immutable strict;
+create function ifnull(opd vops_timestamptz, subst vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_coalesce_int8' language C parallel safe immutable strict;
+
+create function vops_timestamptz_neg(right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_neg' language C parallel safe immutable strict;
+create operator - (rightarg=vops_timestamptz, procedure=vops_timestamptz_neg);
+
+create function vops_timestamptz_sum_accumulate(state int8, val vops_timestamptz) returns int8 as 'MODULE_PATHNAME','vops_int8_sum_accumulate' language C parallel safe;
+create aggregate sum(vops_timestamptz) (
+	sfunc = vops_timestamptz_sum_accumulate,
+	stype = int8,
+	combinefunc = int8pl,
+	parallel = safe
+);
+create function vops_timestamptz_sum_extend(state vops_int8, val vops_timestamptz) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_sum_extend' language C parallel safe;
+create function vops_timestamptz_sum_reduce(state vops_int8, val vops_timestamptz) returns vops_int8 as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate msum(vops_timestamptz) (
+	sfunc = vops_timestamptz_sum_extend,
+	stype = vops_int8,
+	mstype = vops_int8,
+	msfunc = vops_timestamptz_sum_extend,
+	minvfunc = vops_timestamptz_sum_reduce,
+	parallel = safe
+);
+
+create function vops_timestamptz_msum_extend(state internal, val vops_timestamptz, winsize integer) returns internal as 'MODULE_PATHNAME','vops_int8_msum_extend' language C parallel safe;
+create function vops_timestamptz_msum_reduce(state internal, val vops_timestamptz, winsize integer) returns internal as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create function vops_timestamptz_msum_final(state internal) returns vops_int8 as 'MODULE_PATHNAME','vops_win_final' language C parallel safe strict;
+create aggregate msum(vops_timestamptz, winsize integer) (
+	sfunc = vops_timestamptz_msum_extend,
+	stype = internal,
+	finalfunc = vops_timestamptz_msum_final,
+	mstype = internal,
+	msfunc = vops_timestamptz_msum_extend,
+	minvfunc = vops_timestamptz_msum_reduce,
+	mfinalfunc = vops_timestamptz_msum_final,
+	parallel = safe
+);
+
+create function vops_timestamptz_var_accumulate(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_var_accumulate' language C parallel safe;
+create aggregate var_pop(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_var_pop_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create aggregate var_samp(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_var_samp_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create aggregate variance(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_var_samp_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create aggregate stddev_pop(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_stddev_pop_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create aggregate stddev_samp(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_stddev_samp_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create aggregate stddev(vops_timestamptz) (
+	sfunc = vops_timestamptz_var_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_stddev_samp_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create function vops_timestamptz_wavg_accumulate(state internal, x vops_timestamptz, y vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_wavg_accumulate' language C parallel safe;
+create aggregate wavg(vops_timestamptz, vops_timestamptz) (
+	sfunc = vops_timestamptz_wavg_accumulate,
+	stype = internal,
+	sspace = 24,
+	finalfunc = vops_wavg_final,
+	combinefunc = vops_var_combine,
+	serialfunc = vops_var_serial,
+	deserialfunc = vops_var_deserial,
+	parallel = safe
+);
+
+create function vops_timestamptz_avg_accumulate(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_avg_accumulate' language C parallel safe;
+create aggregate avg(vops_timestamptz) (
+	sfunc = vops_timestamptz_avg_accumulate,
+	stype = internal,
+	sspace = 16,
+	finalfunc = vops_avg_final,
+	combinefunc = vops_avg_combine,
+	serialfunc = vops_avg_serial,
+	deserialfunc = vops_avg_deserial,
+	parallel = safe
+);
+create function vops_timestamptz_avg_extend(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_avg_extend' language C parallel safe;
+create function vops_timestamptz_avg_reduce(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate mavg(vops_timestamptz) (
+	sfunc = vops_timestamptz_avg_extend,
+	stype = internal,
+	finalfunc = vops_mavg_final,
+	mstype = internal,
+	msfunc = vops_timestamptz_avg_extend,
+	minvfunc = vops_timestamptz_avg_reduce,
+	mfinalfunc = vops_mavg_final,
+	parallel = safe
+);
+
+create function vops_timestamptz_max_accumulate(state timestamptz, val vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_max_accumulate' language C parallel safe;
+create aggregate max(vops_timestamptz) (
+	sfunc = vops_timestamptz_max_accumulate,
+	stype = timestamptz,
+	combinefunc = timestamptz_larger,
+	parallel = safe
+);
+create function vops_timestamptz_max_extend(state vops_timestamptz, val vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_max_extend' language C parallel safe;
+create function vops_timestamptz_max_reduce(state vops_timestamptz, val vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate mmax(vops_timestamptz) (
+	sfunc = vops_timestamptz_max_extend,
+	stype = vops_timestamptz,
+	mstype = vops_timestamptz,
+	msfunc = vops_timestamptz_max_extend,
+	minvfunc = vops_timestamptz_max_reduce,
+	parallel = safe
+);
+
+create function vops_timestamptz_min_accumulate(state timestamptz, val vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_min_accumulate' language C parallel safe;
+create aggregate min(vops_timestamptz) (
+	sfunc = vops_timestamptz_min_accumulate,
+	stype = timestamptz,
+	combinefunc = timestamptz_smaller,
+	parallel = safe
+);
+create function vops_timestamptz_min_extend(state vops_timestamptz, val vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_int8_min_extend' language C parallel safe;
+create function vops_timestamptz_min_reduce(state vops_timestamptz, val vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe;
+create aggregate mmin(vops_timestamptz) (
+	sfunc = vops_timestamptz_min_extend,
+	stype = vops_timestamptz,
+	mstype = vops_timestamptz,
+	msfunc = vops_timestamptz_min_extend,
+	minvfunc = vops_timestamptz_min_reduce,
+	parallel = safe
+);
+
+create function vops_timestamptz_lag_extend(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_lag_extend' language C parallel safe;
+create function vops_timestamptz_lag_reduce(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_lag_reduce' language C parallel safe;
+create function vops_timestamptz_lag_final(state internal) returns vops_timestamptz as 'MODULE_PATHNAME','vops_win_final' language C parallel safe strict;
+create aggregate lag(vops_timestamptz) (
+	sfunc = vops_timestamptz_lag_extend,
+	stype = internal,
+	finalfunc = vops_timestamptz_lag_final,
+	mstype = internal,
+	msfunc = vops_timestamptz_lag_extend,
+	minvfunc = vops_timestamptz_lag_reduce,
+	mfinalfunc = vops_timestamptz_lag_final,
+	parallel = safe
+);
+
+create function vops_timestamptz_count_accumulate(state int8, val vops_timestamptz) returns int8 as 'MODULE_PATHNAME','vops_count_any_accumulate' language C parallel safe strict;
+create aggregate count(vops_timestamptz) (
+	sfunc = vops_timestamptz_count_accumulate,
+	stype = int8,
+	combinefunc = int8pl,
+	INITCOND = '0',
+	parallel = safe
+);
+create function vops_timestamptz_count_extend(state vops_int8, val vops_timestamptz) returns vops_int8 as 'MODULE_PATHNAME','vops_count_any_extend' language C parallel safe strict;
+create function vops_timestamptz_count_reduce(state vops_int8, val vops_timestamptz) returns vops_int8 as 'MODULE_PATHNAME','vops_window_reduce' language C parallel safe strict;
+create aggregate mcount(vops_timestamptz) (
+	sfunc = vops_timestamptz_count_extend,
+	stype = vops_int8,
+	initcond = '0',
+	mstype = vops_int8,
+	msfunc = vops_timestamptz_count_extend,
+	minvfunc = vops_timestamptz_count_reduce,
+	minitcond = '0',
+	parallel = safe
+);
+
+create function vops_timestamptz_approxdc_accumulate(state internal, val vops_timestamptz) returns internal as 'MODULE_PATHNAME','vops_int8_approxdc_accumulate' language C parallel safe;
+create aggregate approxdc(vops_timestamptz) (
+	sfunc = vops_timestamptz_approxdc_accumulate,
+	stype = internal,
+	sspace = 128,
+	finalfunc = vops_approxdc_final,
+	combinefunc = vops_approxdc_combine,
+	serialfunc = vops_approxdc_serial,
+	deserialfunc = vops_approxdc_deserial,
+	parallel = safe
+);
+
+create function first(tile vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_first' language C parallel safe immutable strict;
+create function last(tile vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_last' language C parallel safe immutable strict;
+create function low(tile vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_low' language C parallel safe immutable strict;
+create function high(tile vops_timestamptz) returns timestamptz as 'MODULE_PATHNAME','vops_int8_high' language C parallel safe immutable strict;
+
+create function date_part(field text, tile vops_date) returns vops_int4 as 'MODULE_PATHNAME','vops_date_part_date' language C parallel safe immutable strict;
+
+create function date_part(field text, tile vops_timestamp) returns vops_int4 as 'MODULE_PATHNAME','vops_date_part_timestamp' language C parallel safe immutable strict;
+
+create function date_part(field text, tile vops_timestamptz) returns vops_int4 as 'MODULE_PATHNAME','vops_date_part_timestamptz' language C parallel safe stable strict;
+
+create function vops_if(cond vops_bool, left vops_text, right vops_text) returns vops_text as 'MODULE_PATHNAME','vops_if_text' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_text) returns vops_text as 'MODULE_PATHNAME','vops_if_text_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_char, right vops_char) returns vops_char as 'MODULE_PATHNAME','vops_if_char' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_char, right "char") returns vops_char as 'MODULE_PATHNAME','vops_if_char_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left "char", right vops_char) returns vops_char as 'MODULE_PATHNAME','vops_if_char_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_char) returns vops_char as 'MODULE_PATHNAME','vops_if_char_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_int2, right vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_if_int2' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int2, right int4) returns vops_int2 as 'MODULE_PATHNAME','vops_if_int2_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left int4, right vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_if_int2_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_if_int2_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_int4, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_if_int4' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int4, right int4) returns vops_int4 as 'MODULE_PATHNAME','vops_if_int4_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left int4, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_if_int4_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_if_int4_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_date, right vops_date) returns vops_date as 'MODULE_PATHNAME','vops_if_int4' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_date, right date) returns vops_date as 'MODULE_PATHNAME','vops_if_int4_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left date, right vops_date) returns vops_date as 'MODULE_PATHNAME','vops_if_int4_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_date) returns vops_date as 'MODULE_PATHNAME','vops_if_int4_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_timestamp, right vops_timestamp) returns vops_timestamp as 'MODULE_PATHNAME','vops_if_int8' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_timestamp, right timestamp) returns vops_timestamp as 'MODULE_PATHNAME','vops_if_int8_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left timestamp, right vops_timestamp) returns vops_timestamp as 'MODULE_PATHNAME','vops_if_int8_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_timestamp) returns vops_timestamp as 'MODULE_PATHNAME','vops_if_int8_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_timestamptz, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_if_int8' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_timestamptz, right timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_if_int8_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left timestamptz, right vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_if_int8_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_timestamptz) returns vops_timestamptz as 'MODULE_PATHNAME','vops_if_int8_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_interval, right vops_interval) returns vops_interval as 'MODULE_PATHNAME','vops_if_int8' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_interval, right deltatime) returns vops_interval as 'MODULE_PATHNAME','vops_if_int8_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left deltatime, right vops_interval) returns vops_interval as 'MODULE_PATHNAME','vops_if_int8_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_interval) returns vops_interval as 'MODULE_PATHNAME','vops_if_int8_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_int8, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_if_int8' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int8, right int8) returns vops_int8 as 'MODULE_PATHNAME','vops_if_int8_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left int8, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_if_int8_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_if_int8_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_float4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_if_float4' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_float4, right float8) returns vops_float4 as 'MODULE_PATHNAME','vops_if_float4_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left float8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_if_float4_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_if_float4_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_if_float8' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_float8, right float8) returns vops_float8 as 'MODULE_PATHNAME','vops_if_float8_rconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_if_float8_lconst' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_if_float8_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_numeric, right vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_if_numeric' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_numeric) returns vops_numeric as 'MODULE_PATHNAME','vops_if_numeric_else_null' language C parallel safe immutable strict;
+
+create function vops_if(cond vops_bool, left vops_bool, right vops_bool) returns vops_bool as 'MODULE_PATHNAME','vops_if_bool' language C parallel safe immutable strict;
+create function vops_if(cond vops_bool, left vops_bool) returns vops_bool as 'MODULE_PATHNAME','vops_if_bool_else_null' language C parallel safe immutable strict;
+
+create function abs(opd vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_int2_abs' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int2, right vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_int2_greatest' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int2, right int4) returns vops_int2 as 'MODULE_PATHNAME','vops_int2_greatest_rconst' language C parallel safe immutable strict;
+create function vops_least(left vops_int2, right vops_int2) returns vops_int2 as 'MODULE_PATHNAME','vops_int2_least' language C parallel safe immutable strict;
+create function vops_least(left vops_int2, right int4) returns vops_int2 as 'MODULE_PATHNAME','vops_int2_least_rconst' language C parallel safe immutable strict;
+
+create function abs(opd vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_int4_abs' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int4, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_int4_greatest' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int4, right int4) returns vops_int4 as 'MODULE_PATHNAME','vops_int4_greatest_rconst' language C parallel safe immutable strict;
+create function vops_least(left vops_int4, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME','vops_int4_least' language C parallel safe immutable strict;
+create function vops_least(left vops_int4, right int4) returns vops_int4 as 'MODULE_PATHNAME','vops_int4_least_rconst' language C parallel safe immutable strict;
+
+create function abs(opd vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_abs' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int8, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_greatest' language C parallel safe immutable strict;
+create function vops_greatest(left vops_int8, right int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_greatest_rconst' language C parallel safe immutable strict;
+create function vops_least(left vops_int8, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_least' language C parallel safe immutable strict;
+create function vops_least(left vops_int8, right int8) returns vops_int8 as 'MODULE_PATHNAME','vops_int8_least_rconst' language C parallel safe immutable strict;
+
+create function abs(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_abs' language C parallel safe immutable strict;
+create function round(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_round' language C parallel safe immutable strict;
+create function floor(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_floor' language C parallel safe immutable strict;
+create function ceil(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_ceil' language C parallel safe immutable strict;
+create function sqrt(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_sqrt' language C parallel safe immutable strict;
+create function ln(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_ln' language C parallel safe immutable strict;
+create function exp(opd vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_exp' language C parallel safe immutable strict;
+create function power(left vops_float4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_power' language C parallel safe immutable strict;
+create function power(left vops_float4, right float8) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_power_rconst' language C parallel safe immutable strict;
+create function power(left float8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_power_lconst' language C parallel safe immutable strict;
+create function vops_greatest(left vops_float4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_greatest' language C parallel safe immutable strict;
+create function vops_greatest(left vops_float4, right float8) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_greatest_rconst' language C parallel safe immutable strict;
+create function vops_least(left vops_float4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_least' language C parallel safe immutable strict;
+create function vops_least(left vops_float4, right float8) returns vops_float4 as 'MODULE_PATHNAME','vops_float4_least_rconst' language C parallel safe immutable strict;
+
+create function abs(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_abs' language C parallel safe immutable strict;
+create function round(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_round' language C parallel safe immutable strict;
+create function floor(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_floor' language C parallel safe immutable strict;
+create function ceil(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_ceil' language C parallel safe immutable strict;
+create function sqrt(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_sqrt' language C parallel safe immutable strict;
+create function ln(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_ln' language C parallel safe immutable strict;
+create function exp(opd vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_exp' language C parallel safe immutable strict;
+create function power(left vops_float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_power' language C parallel safe immutable strict;
+create function power(left vops_float8, right float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_power_rconst' language C parallel safe immutable strict;
+create function power(left float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_power_lconst' language C parallel safe immutable strict;
+create function vops_greatest(left vops_float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_greatest' language C parallel safe immutable strict;
+create function vops_greatest(left vops_float8, right float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_greatest_rconst' language C parallel safe immutable strict;
+create function vops_least(left vops_float8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_least' language C parallel safe immutable strict;
+create function vops_least(left vops_float8, right float8) returns vops_float8 as 'MODULE_PATHNAME','vops_float8_least_rconst' language C parallel safe immutable strict;
+
+-- Casts between tiles
+
+create function vops_int2_to_int4(opd vops_int2) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int2 as vops_int4) with function vops_int2_to_int4(vops_int2) as implicit;
+create function vops_int2_to_int8(opd vops_int2) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int2 as vops_int8) with function vops_int2_to_int8(vops_int2) as implicit;
+create function vops_int2_to_float4(opd vops_int2) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int2 as vops_float4) with function vops_int2_to_float4(vops_int2) as implicit;
+create function vops_int2_to_float8(opd vops_int2) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int2 as vops_float8) with function vops_int2_to_float8(vops_int2) as implicit;
+
+create function vops_int4_to_int2(opd vops_int4) returns vops_int2 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int4 as vops_int2) with function vops_int4_to_int2(vops_int4) as assignment;
+create function vops_int4_to_int8(opd vops_int4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int4 as vops_int8) with function vops_int4_to_int8(vops_int4) as implicit;
+create function vops_int4_to_float4(opd vops_int4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int4 as vops_float4) with function vops_int4_to_float4(vops_int4) as implicit;
+create function vops_int4_to_float8(opd vops_int4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int4 as vops_float8) with function vops_int4_to_float8(vops_int4) as implicit;
+
+create function vops_int8_to_int2(opd vops_int8) returns vops_int2 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int8 as vops_int2) with function vops_int8_to_int2(vops_int8) as assignment;
+create function vops_int8_to_int4(opd vops_int8) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int8 as vops_int4) with function vops_int8_to_int4(vops_int8) as assignment;
+create function vops_int8_to_float4(opd vops_int8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int8 as vops_float4) with function vops_int8_to_float4(vops_int8) as implicit;
+create function vops_int8_to_float8(opd vops_int8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_int8 as vops_float8) with function vops_int8_to_float8(vops_int8) as implicit;
+
+create function vops_float4_to_int2(opd vops_float4) returns vops_int2 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float4 as vops_int2) with function vops_float4_to_int2(vops_float4) as assignment;
+create function vops_float4_to_int4(opd vops_float4) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float4 as vops_int4) with function vops_float4_to_int4(vops_float4) as assignment;
+create function vops_float4_to_int8(opd vops_float4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float4 as vops_int8) with function vops_float4_to_int8(vops_float4) as assignment;
+create function vops_float4_to_float8(opd vops_float4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float4 as vops_float8) with function vops_float4_to_float8(vops_float4) as implicit;
+
+create function vops_float8_to_int2(opd vops_float8) returns vops_int2 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float8 as vops_int2) with function vops_float8_to_int2(vops_float8) as assignment;
+create function vops_float8_to_int4(opd vops_float8) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float8 as vops_int4) with function vops_float8_to_int4(vops_float8) as assignment;
+create function vops_float8_to_int8(opd vops_float8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float8 as vops_int8) with function vops_float8_to_int8(vops_float8) as assignment;
+create function vops_float8_to_float4(opd vops_float8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_float8 as vops_float4) with function vops_float8_to_float4(vops_float8) as assignment;
+
+create function vops_date_to_timestamp(opd vops_date) returns vops_timestamp as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_date as vops_timestamp) with function vops_date_to_timestamp(vops_date) as implicit;
+create function vops_timestamp_to_date(opd vops_timestamp) returns vops_date as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create cast (vops_timestamp as vops_date) with function vops_timestamp_to_date(vops_timestamp) as assignment;
+
+-- Arithmetic operators for tiles of different types
+
+create function vops_int2_int4_add(left vops_int2, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int2, rightarg=vops_int4, procedure=vops_int2_int4_add, commutator= +);
+create function vops_int2_int4_sub(left vops_int2, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int2, rightarg=vops_int4, procedure=vops_int2_int4_sub);
+create function vops_int2_int4_mul(left vops_int2, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int2, rightarg=vops_int4, procedure=vops_int2_int4_mul, commutator= *);
+create function vops_int2_int4_div(left vops_int2, right vops_int4) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int2, rightarg=vops_int4, procedure=vops_int2_int4_div);
+create function vops_int4_int2_add(left vops_int4, right vops_int2) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int4, rightarg=vops_int2, procedure=vops_int4_int2_add, commutator= +);
+create function vops_int4_int2_sub(left vops_int4, right vops_int2) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int4, rightarg=vops_int2, procedure=vops_int4_int2_sub);
+create function vops_int4_int2_mul(left vops_int4, right vops_int2) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int4, rightarg=vops_int2, procedure=vops_int4_int2_mul, commutator= *);
+create function vops_int4_int2_div(left vops_int4, right vops_int2) returns vops_int4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int4, rightarg=vops_int2, procedure=vops_int4_int2_div);
+
+create function vops_int2_int8_add(left vops_int2, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int2, rightarg=vops_int8, procedure=vops_int2_int8_add, commutator= +);
+create function vops_int2_int8_sub(left vops_int2, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int2, rightarg=vops_int8, procedure=vops_int2_int8_sub);
+create function vops_int2_int8_mul(left vops_int2, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int2, rightarg=vops_int8, procedure=vops_int2_int8_mul, commutator= *);
+create function vops_int2_int8_div(left vops_int2, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int2, rightarg=vops_int8, procedure=vops_int2_int8_div);
+create function vops_int8_int2_add(left vops_int8, right vops_int2) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int8, rightarg=vops_int2, procedure=vops_int8_int2_add, commutator= +);
+create function vops_int8_int2_sub(left vops_int8, right vops_int2) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int8, rightarg=vops_int2, procedure=vops_int8_int2_sub);
+create function vops_int8_int2_mul(left vops_int8, right vops_int2) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int8, rightarg=vops_int2, procedure=vops_int8_int2_mul, commutator= *);
+create function vops_int8_int2_div(left vops_int8, right vops_int2) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int8, rightarg=vops_int2, procedure=vops_int8_int2_div);
+
+create function vops_int2_float4_add(left vops_int2, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int2, rightarg=vops_float4, procedure=vops_int2_float4_add, commutator= +);
+create function vops_int2_float4_sub(left vops_int2, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int2, rightarg=vops_float4, procedure=vops_int2_float4_sub);
+create function vops_int2_float4_mul(left vops_int2, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int2, rightarg=vops_float4, procedure=vops_int2_float4_mul, commutator= *);
+create function vops_int2_float4_div(left vops_int2, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int2, rightarg=vops_float4, procedure=vops_int2_float4_div);
+create function vops_float4_int2_add(left vops_float4, right vops_int2) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float4, rightarg=vops_int2, procedure=vops_float4_int2_add, commutator= +);
+create function vops_float4_int2_sub(left vops_float4, right vops_int2) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float4, rightarg=vops_int2, procedure=vops_float4_int2_sub);
+create function vops_float4_int2_mul(left vops_float4, right vops_int2) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float4, rightarg=vops_int2, procedure=vops_float4_int2_mul, commutator= *);
+create function vops_float4_int2_div(left vops_float4, right vops_int2) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float4, rightarg=vops_int2, procedure=vops_float4_int2_div);
+
+create function vops_int2_float8_add(left vops_int2, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int2, rightarg=vops_float8, procedure=vops_int2_float8_add, commutator= +);
+create function vops_int2_float8_sub(left vops_int2, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int2, rightarg=vops_float8, procedure=vops_int2_float8_sub);
+create function vops_int2_float8_mul(left vops_int2, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int2, rightarg=vops_float8, procedure=vops_int2_float8_mul, commutator= *);
+create function vops_int2_float8_div(left vops_int2, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int2, rightarg=vops_float8, procedure=vops_int2_float8_div);
+create function vops_float8_int2_add(left vops_float8, right vops_int2) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float8, rightarg=vops_int2, procedure=vops_float8_int2_add, commutator= +);
+create function vops_float8_int2_sub(left vops_float8, right vops_int2) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float8, rightarg=vops_int2, procedure=vops_float8_int2_sub);
+create function vops_float8_int2_mul(left vops_float8, right vops_int2) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float8, rightarg=vops_int2, procedure=vops_float8_int2_mul, commutator= *);
+create function vops_float8_int2_div(left vops_float8, right vops_int2) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float8, rightarg=vops_int2, procedure=vops_float8_int2_div);
+
+create function vops_int4_int8_add(left vops_int4, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int4, rightarg=vops_int8, procedure=vops_int4_int8_add, commutator= +);
+create function vops_int4_int8_sub(left vops_int4, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int4, rightarg=vops_int8, procedure=vops_int4_int8_sub);
+create function vops_int4_int8_mul(left vops_int4, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int4, rightarg=vops_int8, procedure=vops_int4_int8_mul, commutator= *);
+create function vops_int4_int8_div(left vops_int4, right vops_int8) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int4, rightarg=vops_int8, procedure=vops_int4_int8_div);
+create function vops_int8_int4_add(left vops_int8, right vops_int4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int8, rightarg=vops_int4, procedure=vops_int8_int4_add, commutator= +);
+create function vops_int8_int4_sub(left vops_int8, right vops_int4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int8, rightarg=vops_int4, procedure=vops_int8_int4_sub);
+create function vops_int8_int4_mul(left vops_int8, right vops_int4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int8, rightarg=vops_int4, procedure=vops_int8_int4_mul, commutator= *);
+create function vops_int8_int4_div(left vops_int8, right vops_int4) returns vops_int8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int8, rightarg=vops_int4, procedure=vops_int8_int4_div);
+
+create function vops_int4_float4_add(left vops_int4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int4, rightarg=vops_float4, procedure=vops_int4_float4_add, commutator= +);
+create function vops_int4_float4_sub(left vops_int4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int4, rightarg=vops_float4, procedure=vops_int4_float4_sub);
+create function vops_int4_float4_mul(left vops_int4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int4, rightarg=vops_float4, procedure=vops_int4_float4_mul, commutator= *);
+create function vops_int4_float4_div(left vops_int4, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int4, rightarg=vops_float4, procedure=vops_int4_float4_div);
+create function vops_float4_int4_add(left vops_float4, right vops_int4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float4, rightarg=vops_int4, procedure=vops_float4_int4_add, commutator= +);
+create function vops_float4_int4_sub(left vops_float4, right vops_int4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float4, rightarg=vops_int4, procedure=vops_float4_int4_sub);
+create function vops_float4_int4_mul(left vops_float4, right vops_int4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float4, rightarg=vops_int4, procedure=vops_float4_int4_mul, commutator= *);
+create function vops_float4_int4_div(left vops_float4, right vops_int4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float4, rightarg=vops_int4, procedure=vops_float4_int4_div);
+
+create function vops_int4_float8_add(left vops_int4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int4, rightarg=vops_float8, procedure=vops_int4_float8_add, commutator= +);
+create function vops_int4_float8_sub(left vops_int4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int4, rightarg=vops_float8, procedure=vops_int4_float8_sub);
+create function vops_int4_float8_mul(left vops_int4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int4, rightarg=vops_float8, procedure=vops_int4_float8_mul, commutator= *);
+create function vops_int4_float8_div(left vops_int4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int4, rightarg=vops_float8, procedure=vops_int4_float8_div);
+create function vops_float8_int4_add(left vops_float8, right vops_int4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float8, rightarg=vops_int4, procedure=vops_float8_int4_add, commutator= +);
+create function vops_float8_int4_sub(left vops_float8, right vops_int4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float8, rightarg=vops_int4, procedure=vops_float8_int4_sub);
+create function vops_float8_int4_mul(left vops_float8, right vops_int4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float8, rightarg=vops_int4, procedure=vops_float8_int4_mul, commutator= *);
+create function vops_float8_int4_div(left vops_float8, right vops_int4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float8, rightarg=vops_int4, procedure=vops_float8_int4_div);
+
+create function vops_int8_float4_add(left vops_int8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int8, rightarg=vops_float4, procedure=vops_int8_float4_add, commutator= +);
+create function vops_int8_float4_sub(left vops_int8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int8, rightarg=vops_float4, procedure=vops_int8_float4_sub);
+create function vops_int8_float4_mul(left vops_int8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int8, rightarg=vops_float4, procedure=vops_int8_float4_mul, commutator= *);
+create function vops_int8_float4_div(left vops_int8, right vops_float4) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int8, rightarg=vops_float4, procedure=vops_int8_float4_div);
+create function vops_float4_int8_add(left vops_float4, right vops_int8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float4, rightarg=vops_int8, procedure=vops_float4_int8_add, commutator= +);
+create function vops_float4_int8_sub(left vops_float4, right vops_int8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float4, rightarg=vops_int8, procedure=vops_float4_int8_sub);
+create function vops_float4_int8_mul(left vops_float4, right vops_int8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float4, rightarg=vops_int8, procedure=vops_float4_int8_mul, commutator= *);
+create function vops_float4_int8_div(left vops_float4, right vops_int8) returns vops_float4 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float4, rightarg=vops_int8, procedure=vops_float4_int8_div);
+
+create function vops_int8_float8_add(left vops_int8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_int8, rightarg=vops_float8, procedure=vops_int8_float8_add, commutator= +);
+create function vops_int8_float8_sub(left vops_int8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_int8, rightarg=vops_float8, procedure=vops_int8_float8_sub);
+create function vops_int8_float8_mul(left vops_int8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_int8, rightarg=vops_float8, procedure=vops_int8_float8_mul, commutator= *);
+create function vops_int8_float8_div(left vops_int8, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_int8, rightarg=vops_float8, procedure=vops_int8_float8_div);
+create function vops_float8_int8_add(left vops_float8, right vops_int8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float8, rightarg=vops_int8, procedure=vops_float8_int8_add, commutator= +);
+create function vops_float8_int8_sub(left vops_float8, right vops_int8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float8, rightarg=vops_int8, procedure=vops_float8_int8_sub);
+create function vops_float8_int8_mul(left vops_float8, right vops_int8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float8, rightarg=vops_int8, procedure=vops_float8_int8_mul, commutator= *);
+create function vops_float8_int8_div(left vops_float8, right vops_int8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float8, rightarg=vops_int8, procedure=vops_float8_int8_div);
+
+create function vops_float4_float8_add(left vops_float4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float4, rightarg=vops_float8, procedure=vops_float4_float8_add, commutator= +);
+create function vops_float4_float8_sub(left vops_float4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float4, rightarg=vops_float8, procedure=vops_float4_float8_sub);
+create function vops_float4_float8_mul(left vops_float4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float4, rightarg=vops_float8, procedure=vops_float4_float8_mul, commutator= *);
+create function vops_float4_float8_div(left vops_float4, right vops_float8) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float4, rightarg=vops_float8, procedure=vops_float4_float8_div);
+create function vops_float8_float4_add(left vops_float8, right vops_float4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator + (leftarg=vops_float8, rightarg=vops_float4, procedure=vops_float8_float4_add, commutator= +);
+create function vops_float8_float4_sub(left vops_float8, right vops_float4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator - (leftarg=vops_float8, rightarg=vops_float4, procedure=vops_float8_float4_sub);
+create function vops_float8_float4_mul(left vops_float8, right vops_float4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator * (leftarg=vops_float8, rightarg=vops_float4, procedure=vops_float8_float4_mul, commutator= *);
+create function vops_float8_float4_div(left vops_float8, right vops_float4) returns vops_float8 as 'MODULE_PATHNAME' language C parallel safe immutable strict;
+create operator / (leftarg=vops_float8, rightarg=vops_float4, procedure=vops_float8_float4_div);
+
+create function vops_filter_support(internal) returns internal as 'MODULE_PATHNAME' language C strict;
+create function vops_operator_support(internal) returns internal as 'MODULE_PATHNAME' language C strict;
+create function vops_reduce_support(internal) returns internal as 'MODULE_PATHNAME' language C strict;
+create function vops_unnest_support(internal) returns internal as 'MODULE_PATHNAME' language C strict;
+
+create function vops_lookup(dimension regclass, key_column text, key vops_int2, attr_column text, result anyelement) returns anyelement as 'MODULE_PATHNAME','vops_lookup' language C parallel safe stable;
+create function vops_lookup(dimension regclass, key_column text, key vops_int4, attr_column text, result anyelement) returns anyelement as 'MODULE_PATHNAME','vops_lookup' language C parallel safe stable;
+create function vops_lookup(dimension regclass, key_column text, key vops_int8, attr_column text, result anyelement) returns anyelement as 'MODULE_PATHNAME','vops_lookup' language C parallel safe stable;
+
+create function vops_in(key vops_int2, keys anyarray) returns vops_bool as 'MODULE_PATHNAME','vops_in' language C parallel safe strict immutable;
+create function vops_in(key vops_int4, keys anyarray) returns vops_bool as 'MODULE_PATHNAME','vops_in' language C parallel safe strict immutable;
+create function vops_in(key vops_int8, keys anyarray) returns vops_bool as 'MODULE_PATHNAME','vops_in' language C parallel safe strict immutable;
+
+-- Planner support functions are available since PostgreSQL 12
+do $$
+declare
+	func regprocedure;
+begin
+	if current_setting('server_version_num')::integer >= 120000 then
+		execute 'alter function filter(vops_bool) support vops_filter_support';
+		execute 'alter function vops_unnest(anyelement) support vops_unnest_support';
+		execute 'alter function reduce(bigint) support vops_reduce_support';
+		-- vector operators and functions process the whole tile in one call
+		for func in select p.oid::regprocedure from pg_proc p join pg_type t on p.prorettype = t.oid
+			where p.pronamespace = current_schema()::regnamespace and t.typnamespace = p.pronamespace
+			and t.typname like 'vops\_%' and t.typname <> 'vops_rowgroup'
+			and p.prokind = 'f' and p.prosupport = 0
+			and p.prolang = (select oid from pg_language where lanname = 'c')
+			and not exists (select 1 from pg_type where typinput = p.oid or typreceive = p.oid)
+		loop
+			execute 'alter function '||func||' support vops_operator_support';
+		end loop;
+	end if;
+end $$;
@@ -1,5 +1,6 @@
 #include "postgres.h"
 
+#include <ctype.h>
 #include <float.h>
 #include <math.h>
 #include "funcapi.h"
@@ -27,10 +28,15 @@
 
 #include "utils/array.h"
 #include "utils/datum.h"
+#if PG_VERSION_NUM>=110000
+#include "common/int.h"
+#endif
 #if PG_VERSION_NUM>=120000
 #include "access/heapam.h"
+#include "optimizer/optimizer.h"
 #include "utils/float.h"
 #else
+#include "optimizer/var.h"
 #include "utils/tqual.h"
 #endif
 #include "utils/builtins.h"
@@ -38,6 +44,7 @@
 #include <utils/typcache.h>
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
+#include "utils/numeric.h"
 #include "utils/snapmgr.h"
 #include "utils/syscache.h"
 #include "parser/parse_relation.h"
@@ -65,6 +72,26 @@ PG_MODULE_MAGIC;
 #define FUNC_CALL_CTX -1
 #endif
 
+#if PG_VERSION_NUM<110000
+static inline bool
+pg_add_s64_overflow(int64 a, int64 b, int64 *result)
+{
+	return __builtin_add_overflow(a, b, result);
+}
+
+static inline bool
+pg_sub_s64_overflow(int64 a, int64 b, int64 *result)
+{
+	return __builtin_sub_overflow(a, b, result);
+}
+
+static inline bool
+pg_mul_s64_overflow(int64 a, int64 b, int64 *result)
+{
+	return __builtin_mul_overflow(a, b, result);
+}
+#endif
+
 /* pg module functions */
 void		_PG_init(void);
 
@@ -81,10 +108,12 @@ static struct
 	{"vops_int8", InvalidOid},
 	{"vops_date", InvalidOid},
 	{"vops_timestamp", InvalidOid},
+	{"vops_timestamptz", InvalidOid},
 	{"vops_float4", InvalidOid},
 	{"vops_float8", InvalidOid},
 	{"vops_interval", InvalidOid},
-	{"vops_text", InvalidOid}
+	{"vops_text", InvalidOid},
+	{"vops_numeric", InvalidOid}
 };
 
 static struct
@@ -109,13 +138,16 @@ static const Oid vops_map_tid[] =
 	INT8OID,
 	DATEOID,
 	TIMESTAMPOID,
+	TIMESTAMPTZOID,
 	FLOAT4OID,
 	FLOAT8OID,
 	INTERVALOID,
-	TEXTOID
+	TEXTOID,
+	NUMERICOID
 };
 
 static bool vops_auto_substitute_projections;
+static Oid	vops_rowgroup_oid;
 
 static vops_agg_state *vops_init_agg_state(char const *aggregates, Oid elem_type, int n_aggregates);
 static vops_agg_state *vops_create_agg_state(int n_aggregates);
@@ -134,7 +166,7 @@ vops_get_type(Oid typid)
 			vops_type_map[i].oid = TypenameGetTypid(vops_type_map[i].name);
 		}
 	}
-	for (i = 0; i < VOPS_LAST && vops_type_map[i].oid != typid; i++);
+	for (i = 0; i < VOPS_LAST && (vops_type_map[i].oid != typid || typid == InvalidOid); i++);
 	return (vops_type) i;
 }
 
@@ -144,6 +176,53 @@ is_vops_type(Oid typeid)
 	return vops_get_type(typeid) != VOPS_LAST;
 }
 
+/*
+ * Map scalar type to the kind of tile which can store its values
+ */
+static vops_type
+vops_map_scalar_type(Oid scalar_type)
+{
+	int			i;
+
+	if (scalar_type == VARCHAROID || scalar_type == BPCHAROID)
+		return VOPS_TEXT;
+	for (i = 0; i < VOPS_LAST && vops_map_tid[i] != scalar_type; i++);
+	return (vops_type) i;
+}
+
+/*
+ * Get OID of tile type for the specified scalar type or InvalidOid if there is no such tile type
+ */
+Oid
+vops_get_tile_type(Oid scalar_type)
+{
+	vops_type	tid = vops_map_scalar_type(scalar_type);
+
+	if (tid == VOPS_LAST)
+		return InvalidOid;
+	if (vops_type_map[0].oid == InvalidOid)
+		vops_get_type(InvalidOid); /* initialize type map */
+	return vops_type_map[tid].oid;
+}
+
+/*
+ * Get OID of type of tile elements
+ */
+Oid
+vops_get_elem_type(vops_type tid)
+{
+	Assert(tid < VOPS_LAST);
+	return vops_map_tid[tid];
+}
+
+bool
+vops_is_rowgroup_type(Oid typid)
+{
+	if (vops_rowgroup_oid == InvalidOid)
+		vops_rowgroup_oid = TypenameGetTypid("vops_rowgroup");
+	return typid != InvalidOid && typid == vops_rowgroup_oid;
+}
+
 #define SCALAR_PAYLOAD(tile, i) ((tile)->payload[i])
 #define BOOL_PAYLOAD(tile, i)   (((tile)->payload >> (i)) & 1)
 
@@ -268,6 +347,68 @@ is_vops_type(Oid typeid)
 		PG_RETURN_POINTER(result);										\
 	}																	\
 
+#define IF_OP(TYPE,CTYPE,GXTYPE)										\
+	PG_FUNCTION_INFO_V1(vops_if_##TYPE);								\
+	Datum vops_if_##TYPE(PG_FUNCTION_ARGS)								\
+	{																	\
+		vops_bool* cond = (vops_bool*)PG_GETARG_POINTER(0);				\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(1);			\
+		vops_##TYPE* right = (vops_##TYPE*)PG_GETARG_POINTER(2);		\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE)); \
+		uint64 mask = cond->payload & ~cond->hdr.null_mask;				\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = ((mask >> i) & 1) ? left->payload[i] : right->payload[i]; \
+		}																\
+		result->hdr.null_mask = (left->hdr.null_mask & mask) | (right->hdr.null_mask & ~mask); \
+		result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask | right->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_if_##TYPE##_rconst);						\
+	Datum vops_if_##TYPE##_rconst(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_bool* cond = (vops_bool*)PG_GETARG_POINTER(0);				\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(1);			\
+		CTYPE right = (CTYPE)PG_GETARG_##GXTYPE(2);						\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE)); \
+		uint64 mask = cond->payload & ~cond->hdr.null_mask;				\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = ((mask >> i) & 1) ? left->payload[i] : right; \
+		}																\
+		result->hdr.null_mask = left->hdr.null_mask & mask;				\
+		result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_if_##TYPE##_lconst);						\
+	Datum vops_if_##TYPE##_lconst(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_bool* cond = (vops_bool*)PG_GETARG_POINTER(0);				\
+		CTYPE left = (CTYPE)PG_GETARG_##GXTYPE(1);						\
+		vops_##TYPE* right = (vops_##TYPE*)PG_GETARG_POINTER(2);		\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE)); \
+		uint64 mask = cond->payload & ~cond->hdr.null_mask;				\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = ((mask >> i) & 1) ? left : right->payload[i]; \
+		}																\
+		result->hdr.null_mask = right->hdr.null_mask & ~mask;			\
+		result->hdr.empty_mask = cond->hdr.empty_mask | right->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_if_##TYPE##_else_null);					\
+	Datum vops_if_##TYPE##_else_null(PG_FUNCTION_ARGS)					\
+	{																	\
+		vops_bool* cond = (vops_bool*)PG_GETARG_POINTER(0);				\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(1);			\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE)); \
+		uint64 mask = cond->payload & ~cond->hdr.null_mask;				\
+		memcpy(result->payload, left->payload, sizeof(left->payload));	\
+		result->hdr.null_mask = left->hdr.null_mask | ~mask;			\
+		result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+
 #define BIN_RCONST_OP(TYPE,XTYPE,GXTYPE,OP,COP)							\
 	PG_FUNCTION_INFO_V1(vops_##TYPE##_##OP##_rconst);					\
 	Datum vops_##TYPE##_##OP##_rconst(PG_FUNCTION_ARGS)					\
@@ -320,6 +461,193 @@ is_vops_type(Oid typeid)
 		PG_RETURN_POINTER(result);										\
 	}
 
+/*
+ * Math functions. Loops are branch free so that compiler can vectorize them,
+ * domain of arguments is checked only for non-null and non-empty elements.
+ */
+#define NO_CHECK(x,r) false
+#define NEGATIVE_ARG(x,r) ((x) < 0)
+#define NON_POSITIVE_ARG(x,r) ((x) <= 0)
+#define OVERFLOW_RESULT(x,r) (isinf(r) && !isinf(x))
+#define NEGATIVE_RESULT(x,r) ((r) < 0)
+#define INVALID_POWER(x,y,r) (((x) == 0 && (y) < 0) || ((x) < 0 && floor(y) != (y)))
+#define OVERFLOW_POWER(x,y,r) (isinf(r) && !isinf(x) && !isinf(y))
+
+#define MATH_FUNC(TYPE,NAME,FUNC,INVALID,ERRCODE,ERRMSG)				\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME);							\
+	Datum vops_##TYPE##_##NAME(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_##TYPE* opd = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 invalid = 0;												\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = FUNC(opd->payload[i]);					\
+			invalid |= (uint64)INVALID(opd->payload[i], result->payload[i]) << i; \
+		}																\
+		if (invalid & ~(opd->hdr.null_mask | opd->hdr.empty_mask))		\
+			ereport(ERROR, (errcode(ERRCODE), errmsg(ERRMSG)));		\
+		result->hdr = opd->hdr;											\
+		PG_RETURN_POINTER(result);										\
+	}
+
+#define MATH_BIN_FUNC(TYPE,XTYPE,GXTYPE,NAME,FUNC,INVALID,ERRCODE,ERRMSG,OVERFLOW) \
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME);							\
+	Datum vops_##TYPE##_##NAME(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		vops_##TYPE* right = (vops_##TYPE*)PG_GETARG_POINTER(1);		\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 invalid = 0;												\
+		uint64 overflow = 0;											\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = FUNC(left->payload[i], right->payload[i]); \
+			invalid |= (uint64)INVALID(left->payload[i], right->payload[i], result->payload[i]) << i; \
+			overflow |= (uint64)OVERFLOW(left->payload[i], right->payload[i], result->payload[i]) << i; \
+		}																\
+		result->hdr.null_mask = left->hdr.null_mask | right->hdr.null_mask;	\
+		result->hdr.empty_mask = left->hdr.empty_mask | right->hdr.empty_mask; \
+		if (invalid & ~(result->hdr.null_mask | result->hdr.empty_mask))	\
+			ereport(ERROR, (errcode(ERRCODE), errmsg(ERRMSG)));		\
+		if (overflow & ~(result->hdr.null_mask | result->hdr.empty_mask)) \
+			ereport(ERROR, (errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE), errmsg("value out of range: overflow"))); \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME##_rconst);					\
+	Datum vops_##TYPE##_##NAME##_rconst(PG_FUNCTION_ARGS)				\
+	{																	\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		XTYPE right = PG_GETARG_##GXTYPE(1);							\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 invalid = 0;												\
+		uint64 overflow = 0;											\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = FUNC(left->payload[i], right);			\
+			invalid |= (uint64)INVALID(left->payload[i], right, result->payload[i]) << i; \
+			overflow |= (uint64)OVERFLOW(left->payload[i], right, result->payload[i]) << i; \
+		}																\
+		result->hdr = left->hdr;										\
+		if (invalid & ~(result->hdr.null_mask | result->hdr.empty_mask))	\
+			ereport(ERROR, (errcode(ERRCODE), errmsg(ERRMSG)));		\
+		if (overflow & ~(result->hdr.null_mask | result->hdr.empty_mask)) \
+			ereport(ERROR, (errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE), errmsg("value out of range: overflow"))); \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME##_lconst);					\
+	Datum vops_##TYPE##_##NAME##_lconst(PG_FUNCTION_ARGS)				\
+	{																	\
+		XTYPE left = PG_GETARG_##GXTYPE(0);								\
+		vops_##TYPE* right = (vops_##TYPE*)PG_GETARG_POINTER(1);		\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 invalid = 0;												\
+		uint64 overflow = 0;											\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = FUNC(left, right->payload[i]);			\
+			invalid |= (uint64)INVALID(left, right->payload[i], result->payload[i]) << i; \
+			overflow |= (uint64)OVERFLOW(left, right->payload[i], result->payload[i]) << i; \
+		}																\
+		result->hdr = right->hdr;										\
+		if (invalid & ~(result->hdr.null_mask | result->hdr.empty_mask))	\
+			ereport(ERROR, (errcode(ERRCODE), errmsg(ERRMSG)));		\
+		if (overflow & ~(result->hdr.null_mask | result->hdr.empty_mask)) \
+			ereport(ERROR, (errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE), errmsg("value out of range: overflow"))); \
+		PG_RETURN_POINTER(result);										\
+	}
+
+/*
+ * GREATEST and LEAST ignore nulls: result is null only if both arguments are null
+ */
+#define MINMAX_FUNC(TYPE,CTYPE,XTYPE,GXTYPE,NAME,COP)					\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME);							\
+	Datum vops_##TYPE##_##NAME(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		vops_##TYPE* right = (vops_##TYPE*)PG_GETARG_POINTER(1);		\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 left_null = left->hdr.null_mask;							\
+		uint64 right_null = right->hdr.null_mask;						\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			CTYPE l = left->payload[i];									\
+			CTYPE r = right->payload[i];								\
+			result->payload[i] = ((right_null >> i) & 1) ? l : ((left_null >> i) & 1) ? r : (l COP r) ? l : r; \
+		}																\
+		result->hdr.null_mask = left_null & right_null;					\
+		result->hdr.empty_mask = left->hdr.empty_mask | right->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_##NAME##_rconst);					\
+	Datum vops_##TYPE##_##NAME##_rconst(PG_FUNCTION_ARGS)				\
+	{																	\
+		vops_##TYPE* left = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		CTYPE right = (CTYPE)PG_GETARG_##GXTYPE(1);						\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE));\
+		uint64 left_null = left->hdr.null_mask;							\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			CTYPE l = left->payload[i];									\
+			result->payload[i] = ((left_null >> i) & 1) ? right : (l COP right) ? l : right; \
+		}																\
+		result->hdr.null_mask = 0;										\
+		result->hdr.empty_mask = left->hdr.empty_mask;					\
+		PG_RETURN_POINTER(result);										\
+	}
+
+/*
+ * Conversion of tile to tile of another type. Range of values is checked only
+ * for non-null and non-empty elements.
+ */
+#define INT16_OVERFLOW(x) ((x) < PG_INT16_MIN || (x) > PG_INT16_MAX)
+#define INT32_OVERFLOW(x) ((x) < PG_INT32_MIN || (x) > PG_INT32_MAX)
+#define FLOAT_INT16_OVERFLOW(x) (!(rint(x) >= PG_INT16_MIN && rint(x) <= PG_INT16_MAX))
+#define FLOAT_INT32_OVERFLOW(x) (!(rint(x) >= PG_INT32_MIN && rint(x) <= PG_INT32_MAX))
+#define FLOAT_INT64_OVERFLOW(x) (!(rint(x) >= (float8)PG_INT64_MIN && rint(x) < -(float8)PG_INT64_MIN))
+#define FLOAT4_OVERFLOW(x) (!isinf(x) && isinf((float4)(x)))
+#define NO_OVERFLOW(x) false
+#define NO_CONV(x) (x)
+
+#define DATE_TO_TIMESTAMP(x) ((x) == DATEVAL_NOBEGIN ? DT_NOBEGIN : (x) == DATEVAL_NOEND ? DT_NOEND : (int64)(x) * USECS_PER_DAY)
+#define TIMESTAMP_TO_DATE(x) ((x) == DT_NOBEGIN ? DATEVAL_NOBEGIN : (x) == DT_NOEND ? DATEVAL_NOEND : (int32)vops_timestamp_day(x))
+
+#define CAST_FUNC(SRC,DST,SRCTILE,DSTTILE,DCTYPE,CONV,OVERFLOW,ERRMSG)	\
+	PG_FUNCTION_INFO_V1(vops_##SRC##_to_##DST);							\
+	Datum vops_##SRC##_to_##DST(PG_FUNCTION_ARGS)						\
+	{																	\
+		vops_##SRCTILE* opd = (vops_##SRCTILE*)PG_GETARG_POINTER(0);	\
+		vops_##DSTTILE* result = (vops_##DSTTILE*)palloc(sizeof(vops_##DSTTILE)); \
+		uint64 overflow = 0;											\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = (DCTYPE)CONV(opd->payload[i]);			\
+			overflow |= (uint64)OVERFLOW(opd->payload[i]) << i;			\
+		}																\
+		if (overflow & ~(opd->hdr.null_mask | opd->hdr.empty_mask))		\
+			elog(ERROR, ERRMSG);										\
+		result->hdr = opd->hdr;											\
+		PG_RETURN_POINTER(result);										\
+	}
+
+/*
+ * Arithmetic operators for tiles of different types: elements are converted
+ * to the result type inside the loop, so no intermediate tile is constructed.
+ */
+#define MIXED_BIN_OP(LTYPE,RTYPE,RESTYPE,CTYPE,OP,COP)					\
+	PG_FUNCTION_INFO_V1(vops_##LTYPE##_##RTYPE##_##OP);					\
+	Datum vops_##LTYPE##_##RTYPE##_##OP(PG_FUNCTION_ARGS)				\
+	{																	\
+		vops_##LTYPE* left = (vops_##LTYPE*)PG_GETARG_POINTER(0);		\
+		vops_##RTYPE* right = (vops_##RTYPE*)PG_GETARG_POINTER(1);		\
+		vops_##RESTYPE* result = (vops_##RESTYPE*)palloc(sizeof(vops_##RESTYPE)); \
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) result->payload[i] = (CTYPE)left->payload[i] COP (CTYPE)right->payload[i]; \
+		result->hdr.null_mask = left->hdr.null_mask | right->hdr.null_mask;	\
+		result->hdr.empty_mask = left->hdr.empty_mask | right->hdr.empty_mask; \
+		PG_RETURN_POINTER(result);										\
+	}
+
 #define BOOL_BIN_OP(OP,COP)												\
 	PG_FUNCTION_INFO_V1(vops_bool_##OP);								\
 	Datum vops_bool_##OP(PG_FUNCTION_ARGS)								\
@@ -848,6 +1176,53 @@ is_vops_type(Oid typeid)
 		PG_RETURN_CSTRING(str.data);									\
 	}
 
+/*
+ * Binary representation of tile: null and empty masks followed by all
+ * elements in network byte order (values of null and empty elements are
+ * also sent, so no per-element branches are needed).
+ */
+#define SEND_FUNC(TYPE,SEND)											\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_send);							\
+	Datum vops_##TYPE##_send(PG_FUNCTION_ARGS)							\
+	{																	\
+		vops_##TYPE* tile = (vops_##TYPE*)PG_GETARG_POINTER(0);			\
+		StringInfoData buf;												\
+		int i;															\
+		pq_begintypsend(&buf);											\
+		enlargeStringInfo(&buf, sizeof(vops_##TYPE));					\
+		pq_sendint64(&buf, tile->hdr.null_mask);						\
+		pq_sendint64(&buf, tile->hdr.empty_mask);						\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			SEND(&buf, tile->payload[i]);								\
+		}																\
+		PG_RETURN_BYTEA_P(pq_endtypsend(&buf));							\
+	}
+
+#define RECV_FUNC(TYPE,CTYPE,RECV)										\
+	PG_FUNCTION_INFO_V1(vops_##TYPE##_recv);							\
+	Datum vops_##TYPE##_recv(PG_FUNCTION_ARGS)							\
+	{																	\
+		StringInfo buf = (StringInfo)PG_GETARG_POINTER(0);				\
+		vops_##TYPE* result = (vops_##TYPE*)palloc(sizeof(vops_##TYPE)); \
+		int i;															\
+		result->hdr.null_mask = pq_getmsgint64(buf);					\
+		result->hdr.empty_mask = pq_getmsgint64(buf);					\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			result->payload[i] = (CTYPE)RECV(buf);						\
+		}																\
+		PG_RETURN_POINTER(result);										\
+	}
+
+#if PG_VERSION_NUM>=110000
+#define PQ_SENDINT16(buf,x) pq_sendint16(buf, x)
+#define PQ_SENDINT32(buf,x) pq_sendint32(buf, x)
+#else
+#define PQ_SENDINT16(buf,x) pq_sendint(buf, x, 2)
+#define PQ_SENDINT32(buf,x) pq_sendint(buf, x, 4)
+#endif
+#define PQ_GETMSGINT16(buf) pq_getmsgint(buf, 2)
+#define PQ_GETMSGINT32(buf) pq_getmsgint(buf, 4)
+
 
 
 #define GROUP_BY_FUNC(TYPE)												\
@@ -957,6 +1332,33 @@ vops_bool_output(PG_FUNCTION_ARGS)
 							   (long64) tile->hdr.null_mask, (long64) tile->hdr.empty_mask, (long64) tile->payload));
 }
 
+PG_FUNCTION_INFO_V1(vops_bool_send);
+Datum
+vops_bool_send(PG_FUNCTION_ARGS)
+{
+	vops_bool  *tile = (vops_bool *) PG_GETARG_POINTER(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	pq_sendint64(&buf, tile->hdr.null_mask);
+	pq_sendint64(&buf, tile->hdr.empty_mask);
+	pq_sendint64(&buf, tile->payload);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(vops_bool_recv);
+Datum
+vops_bool_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	vops_bool  *result = (vops_bool *) palloc(sizeof(vops_bool));
+
+	result->hdr.null_mask = pq_getmsgint64(buf);
+	result->hdr.empty_mask = pq_getmsgint64(buf);
+	result->payload = pq_getmsgint64(buf);
+	PG_RETURN_POINTER(result);
+}
+
 PG_FUNCTION_INFO_V1(vops_filter);
 Datum
 vops_filter(PG_FUNCTION_ARGS)
@@ -993,6 +1395,37 @@ LAST_AGG(bool, BOOL, BOOL_PAYLOAD)
 FIRST_FUNC(bool, Bool, first, <, BOOL_PAYLOAD)
 FIRST_FUNC(bool, Bool, last, >, BOOL_PAYLOAD)
 
+PG_FUNCTION_INFO_V1(vops_if_bool);
+Datum
+vops_if_bool(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	vops_bool  *left = (vops_bool *) PG_GETARG_POINTER(1);
+	vops_bool  *right = (vops_bool *) PG_GETARG_POINTER(2);
+	vops_bool  *result = (vops_bool *) palloc(sizeof(vops_bool));
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+
+	result->payload = (left->payload & mask) | (right->payload & ~mask);
+	result->hdr.null_mask = (left->hdr.null_mask & mask) | (right->hdr.null_mask & ~mask);
+	result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask | right->hdr.empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(vops_if_bool_else_null);
+Datum
+vops_if_bool_else_null(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	vops_bool  *left = (vops_bool *) PG_GETARG_POINTER(1);
+	vops_bool  *result = (vops_bool *) palloc(sizeof(vops_bool));
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+
+	result->payload = left->payload & mask;
+	result->hdr.null_mask = left->hdr.null_mask | ~mask;
+	result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
 PG_FUNCTION_INFO_V1(vops_count_accumulate);
 Datum
 vops_count_accumulate(PG_FUNCTION_ARGS)
@@ -1092,13 +1525,92 @@ vops_count_all_accumulate(PG_FUNCTION_ARGS)
 	PG_RETURN_INT64(count);
 }
 
-PG_FUNCTION_INFO_V1(vops_time_bucket);
-Datum
-vops_time_bucket(PG_FUNCTION_ARGS)
+/*
+ * Calendar arithmetic on day numbers (days since 2000-01-01, the same as DateADT).
+ * It is used instead of timestamp2tm/tm2timestamp for month, quarter and year buckets and date_part.
+ */
+#define VOPS_DAYS_0000_03_01_TO_2000_01_01 730425
+#define VOPS_DAYS_PER_ERA 146097	/* 400 years */
+
+static inline void
+vops_day_to_civil(int64 day, int *year, int *month, int *mday)
+{
+	int64		z = day + VOPS_DAYS_0000_03_01_TO_2000_01_01;
+	int64		era = (z >= 0 ? z : z - (VOPS_DAYS_PER_ERA - 1)) / VOPS_DAYS_PER_ERA;
+	unsigned	doe = (unsigned) (z - era * VOPS_DAYS_PER_ERA);	/* day of era */
+	unsigned	yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; /* year of era */
+	unsigned	doy = doe - (365 * yoe + yoe / 4 - yoe / 100);	/* day of year starting from March */
+	unsigned	mp = (5 * doy + 2) / 153;
+	unsigned	m = mp < 10 ? mp + 3 : mp - 9;
+
+	*year = (int) (yoe + era * 400 + (m <= 2));
+	*month = (int) m;
+	*mday = (int) (doy - (153 * mp + 2) / 5 + 1);
+}
+
+static inline int64
+vops_civil_to_day(int year, int month, int mday)
+{
+	int64		y = year - (month <= 2);
+	int64		era = (y >= 0 ? y : y - 399) / 400;
+	unsigned	yoe = (unsigned) (y - era * 400);
+	unsigned	doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + mday - 1;
+	unsigned	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+	return era * VOPS_DAYS_PER_ERA + doe - VOPS_DAYS_0000_03_01_TO_2000_01_01;
+}
+
+static inline int64
+vops_timestamp_day(Timestamp ts)
+{
+	int64		day = ts / USECS_PER_DAY;
+
+	return (ts < 0 && day * USECS_PER_DAY != ts) ? day - 1 : day;
+}
+
+/*
+ * Values in tile are usually close to each other, so remember the last month
+ * and perform calendar calculations only when day is out of it.
+ */
+typedef struct
+{
+	int			n_months;
+	int64		month_start;
+	int64		month_end;
+	int64		bucket;
+} vops_month_bucket;
+
+static inline void
+vops_month_bucket_init(vops_month_bucket *mb, int n_months)
+{
+	mb->n_months = n_months;
+	mb->month_start = 0;
+	mb->month_end = 0;
+	mb->bucket = 0;
+}
+
+static inline int64
+vops_month_bucket_day(vops_month_bucket *mb, int64 day)
+{
+	if (day < mb->month_start || day >= mb->month_end)
+	{
+		int			year,
+					month,
+					mday;
+		int			months;
+
+		vops_day_to_civil(day, &year, &month, &mday);
+		mb->month_start = day - mday + 1;
+		mb->month_end = month == 12 ? vops_civil_to_day(year + 1, 1, 1) : vops_civil_to_day(year, month + 1, 1);
+		months = (year * 12 + month - 1) / mb->n_months * mb->n_months;
+		mb->bucket = vops_civil_to_day(months / 12, months % 12 + 1, 1);
+	}
+	return mb->bucket;
+}
+
+static void
+vops_time_bucket_tile(Interval *interval, vops_int8 const *timestamp, vops_int8 *result)
 {
-	Interval   *interval = PG_GETARG_INTERVAL_P(0);
-	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
-	vops_int8  *result = (vops_int8 *) palloc(sizeof(vops_int8));
 	int			i;
 
 	result->hdr = timestamp->hdr;
@@ -1120,41 +1632,34 @@ vops_time_bucket(PG_FUNCTION_ARGS)
 	}
 	else
 	{
-		int			tz;
-		struct pg_tm tm;
-		fsec_t		fsec;
-		Timestamp	dt;
-		int			months;
+		vops_month_bucket mb;
 
 		if (interval->day != 0 || interval->time != 0)
 			elog(ERROR, "Month interval may not include days and time");
 
+		vops_month_bucket_init(&mb, interval->month);
 		for (i = 0; i < TILE_SIZE; i++)
 		{
-			timestamp2tm(timestamp->payload[i], &tz, &tm, &fsec, NULL, NULL);
-			tm.tm_sec = 0;
-			tm.tm_min = 0;
-			tm.tm_hour = 0;
-			tm.tm_sec = 0;
-			tm.tm_mday = 1;
-			months = (tm.tm_year * 12 + tm.tm_mon - 1) / interval->month;
-			tm.tm_year = months / 12;
-			tm.tm_mon = months % 12 + 1;
-			fsec = 0;
-			tm2timestamp(&tm, fsec, &tz, &dt);
-			result->payload[i] = dt;
+			result->payload[i] = vops_month_bucket_day(&mb, vops_timestamp_day(timestamp->payload[i])) * USECS_PER_DAY;
 		}
 	}
-	PG_RETURN_POINTER(result);
 }
 
-PG_FUNCTION_INFO_V1(vops_date_bucket);
+PG_FUNCTION_INFO_V1(vops_time_bucket);
 Datum
-vops_date_bucket(PG_FUNCTION_ARGS)
+vops_time_bucket(PG_FUNCTION_ARGS)
 {
 	Interval   *interval = PG_GETARG_INTERVAL_P(0);
-	vops_int4  *date = (vops_int4 *) PG_GETARG_POINTER(1);
-	vops_int4  *result = (vops_int4 *) palloc(sizeof(vops_int4));
+	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
+	vops_int8  *result = (vops_int8 *) palloc(sizeof(vops_int8));
+
+	vops_time_bucket_tile(interval, timestamp, result);
+	PG_RETURN_POINTER(result);
+}
+
+static void
+vops_date_bucket_tile(Interval *interval, vops_int4 const *date, vops_int4 *result)
+{
 	int			i;
 
 	if (interval->time)
@@ -1173,30 +1678,406 @@ vops_date_bucket(PG_FUNCTION_ARGS)
 	}
 	else
 	{
-		int			year,
-					month,
-					day,
-					months;
+		vops_month_bucket mb;
 
 		if (interval->day != 0)
 			elog(ERROR, "Month interval may not include days");
 
+		vops_month_bucket_init(&mb, interval->month);
 		for (i = 0; i < TILE_SIZE; i++)
 		{
-			j2date(date->payload[i], &year, &month, &day);
-			months = (year * 12 + month - 1) / interval->month;
-			year = months / 12;
-			month = months % 12 + 1;
-			day = 1;
-			result->payload[i] = date2j(year, month, day);
+			result->payload[i] = (int32) vops_month_bucket_day(&mb, date->payload[i]);
 		}
 	}
-	PG_RETURN_POINTER(result);
 }
 
+PG_FUNCTION_INFO_V1(vops_date_bucket);
+Datum
+vops_date_bucket(PG_FUNCTION_ARGS)
+{
+	Interval   *interval = PG_GETARG_INTERVAL_P(0);
+	vops_int4  *date = (vops_int4 *) PG_GETARG_POINTER(1);
+	vops_int4  *result = (vops_int4 *) palloc(sizeof(vops_int4));
+
+	vops_date_bucket_tile(interval, date, result);
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * UTC offsets of time zone in the range of tile values.
+ * Transitions are located once per tile, so conversion of each element to local time is just addition.
+ */
+#define VOPS_TZ_MAX_TRANSITIONS 8
+
+typedef struct
+{
+	pg_tz	   *tz;
+	bool		complete;		/* false if there are more transitions in the range than fit in the table */
+	int			n_transitions;
+	TimestampTz until[VOPS_TZ_MAX_TRANSITIONS];	/* gmtoff[i] is in effect before until[i] */
+	int64		gmtoff[VOPS_TZ_MAX_TRANSITIONS + 1];	/* in microseconds */
+} vops_tz_offsets;
+
+static pg_tz *
+vops_get_timezone(FunctionCallInfo fcinfo, int argno)
+{
+	char	   *tzname;
+	pg_tz	   *tz;
+
+	if (PG_NARGS() <= argno)
+		return session_timezone;
+
+	tzname = text_to_cstring(PG_GETARG_TEXT_PP(argno));
+	tz = pg_tzset(tzname);
+	if (tz == NULL)
+		elog(ERROR, "Time zone \"%s\" is not recognized", tzname);
+	return tz;
+}
+
+static void
+vops_tz_offsets_init(vops_tz_offsets *offs, vops_int8 const *tile, pg_tz *tz)
+{
+	uint64		mask = ~(tile->hdr.empty_mask | tile->hdr.null_mask);
+	TimestampTz min = 0;
+	TimestampTz max = 0;
+	bool		found = false;
+	pg_time_t	t;
+	int			i;
+
+	offs->tz = tz;
+	offs->complete = true;
+	offs->n_transitions = 0;
+	offs->gmtoff[0] = 0;
+
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (mask & ((uint64) 1 << i))
+		{
+			if (!found || tile->payload[i] < min)
+				min = tile->payload[i];
+			if (!found || tile->payload[i] > max)
+				max = tile->payload[i];
+			found = true;
+		}
+	}
+	if (!found)
+		return;
+
+	t = timestamptz_to_time_t(min);
+	while (true)
+	{
+		long int	before_gmtoff;
+		long int	after_gmtoff;
+		int			before_isdst;
+		int			after_isdst;
+		pg_time_t	boundary;
+		int			rc = pg_next_dst_boundary(&t, &before_gmtoff, &before_isdst, &boundary, &after_gmtoff, &after_isdst, tz);
+
+		if (rc < 0)
+			elog(ERROR, "Failed to determine offset of time zone %s", pg_get_timezone_name(tz));
+
+		offs->gmtoff[offs->n_transitions] = (int64) before_gmtoff * USECS_PER_SEC;
+		if (rc == 0 || time_t_to_timestamptz(boundary) > max)
+			break;
+		if (offs->n_transitions == VOPS_TZ_MAX_TRANSITIONS)
+		{
+			offs->complete = false;
+			break;
+		}
+		offs->until[offs->n_transitions++] = time_t_to_timestamptz(boundary);
+		t = boundary;
+	}
+}
+
+static inline int64
+vops_tz_offset(vops_tz_offsets const *offs, TimestampTz ts)
+{
+	int			i;
+
+	for (i = 0; i < offs->n_transitions && ts >= offs->until[i]; i++);
+
+	if (i == VOPS_TZ_MAX_TRANSITIONS && !offs->complete)
+	{
+		/* out of the table: do conversion in the standard way */
+		int			tz;
+		struct pg_tm tm;
+		fsec_t		fsec;
+
+		if (timestamp2tm(ts, &tz, &tm, &fsec, NULL, offs->tz) != 0)
+			elog(ERROR, "timestamp out of range");
+		return (int64) -tz * USECS_PER_SEC;
+	}
+	return offs->gmtoff[i];
+}
+
+static TimestampTz
+vops_local_to_utc(Timestamp local, pg_tz *tz)
+{
+	int			tzoff;
+	struct pg_tm tm;
+	fsec_t		fsec;
+	TimestampTz result;
+
+	if (timestamp2tm(local, NULL, &tm, &fsec, NULL, NULL) != 0)
+		elog(ERROR, "timestamp out of range");
+	tzoff = DetermineTimeZoneOffset(&tm, tz);
+	if (tm2timestamp(&tm, fsec, &tzoff, &result) != 0)
+		elog(ERROR, "timestamp out of range");
+	return result;
+}
+
+/*
+ * Bucketing of timestamptz is done in local time of the specified (or session) time zone.
+ * Start of the bucket is converted back to UTC once per distinct bucket in the tile.
+ */
+PG_FUNCTION_INFO_V1(vops_time_bucket_tz);
+Datum
+vops_time_bucket_tz(PG_FUNCTION_ARGS)
+{
+	Interval   *interval = PG_GETARG_INTERVAL_P(0);
+	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
+	pg_tz	   *tz = vops_get_timezone(fcinfo, 2);
+	vops_int8  *result = (vops_int8 *) palloc(sizeof(vops_int8));
+	uint64		mask = ~(timestamp->hdr.empty_mask | timestamp->hdr.null_mask);
+	vops_tz_offsets offs;
+	vops_int8	local;
+	Timestamp	bucket = 0;
+	TimestampTz bucket_start = 0;
+	bool		has_bucket = false;
+	int			i;
+
+	vops_tz_offsets_init(&offs, timestamp, tz);
+	local.hdr = timestamp->hdr;
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		local.payload[i] = (mask & ((uint64) 1 << i))
+			? timestamp->payload[i] + vops_tz_offset(&offs, timestamp->payload[i])
+			: 0;
+	}
+	vops_time_bucket_tile(interval, &local, result);
+
+	if (offs.n_transitions == 0 && offs.complete)
+	{
+		/* fixed offset in the whole tile range */
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			result->payload[i] -= offs.gmtoff[0];
+		}
+	}
+	else
+	{
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			if (mask & ((uint64) 1 << i))
+			{
+				if (!has_bucket || result->payload[i] != bucket)
+				{
+					bucket = result->payload[i];
+					bucket_start = vops_local_to_utc(bucket, tz);
+					has_bucket = true;
+				}
+				result->payload[i] = bucket_start;
+			}
+		}
+	}
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(vops_date_bucket_tz);
+Datum
+vops_date_bucket_tz(PG_FUNCTION_ARGS)
+{
+	Interval   *interval = PG_GETARG_INTERVAL_P(0);
+	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
+	pg_tz	   *tz = vops_get_timezone(fcinfo, 2);
+	vops_int4  *result = (vops_int4 *) palloc(sizeof(vops_int4));
+	uint64		mask = ~(timestamp->hdr.empty_mask | timestamp->hdr.null_mask);
+	vops_tz_offsets offs;
+	vops_int4	date;
+	int			i;
+
+	vops_tz_offsets_init(&offs, timestamp, tz);
+	date.hdr = timestamp->hdr;
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (mask & ((uint64) 1 << i))
+		{
+			Timestamp	local = timestamp->payload[i] + vops_tz_offset(&offs, timestamp->payload[i]);
+			int64		day = local / USECS_PER_DAY;
+
+			if (local < 0 && day * USECS_PER_DAY != local)
+				day -= 1;
+			date.payload[i] = (int32) day;
+		}
+		else
+		{
+			date.payload[i] = 0;
+		}
+	}
+	vops_date_bucket_tile(interval, &date, result);
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * Vectorized date_part: field is extracted from day number and time of day of each element
+ */
+typedef enum
+{
+	VOPS_FIELD_YEAR,
+	VOPS_FIELD_QUARTER,
+	VOPS_FIELD_MONTH,
+	VOPS_FIELD_DAY,
+	VOPS_FIELD_DOW,
+	VOPS_FIELD_DOY,
+	VOPS_FIELD_HOUR,
+	VOPS_FIELD_MINUTE
+} vops_date_field;
+
+static vops_date_field
+vops_get_date_field(text *field)
+{
+	static char const *const field_names[] = {"year", "quarter", "month", "day", "dow", "doy", "hour", "minute"};
+	char	   *name = text_to_cstring(field);
+	int			i;
+
+	for (i = 0; i < lengthof(field_names); i++)
+	{
+		if (pg_strcasecmp(name, field_names[i]) == 0)
+			return (vops_date_field) i;
+	}
+	elog(ERROR, "Field \"%s\" is not supported for VOPS tiles", name);
+	return VOPS_FIELD_YEAR;		/* keep compiler quiet */
+}
+
+static vops_int4 *
+vops_date_part_tile(vops_date_field field, vops_tile_hdr hdr, int64 const *days, int64 const *usecs)
+{
+	vops_int4  *result = (vops_int4 *) palloc(sizeof(vops_int4));
+	int64		month_start = 0;
+	int64		month_end = 0;
+	int			year = 0;
+	int			month = 0;
+	int			mday;
+	int			i;
+
+	result->hdr = hdr;
+	switch (field)
+	{
+		case VOPS_FIELD_DOW:
+			/* 2000-01-01 is Saturday */
+			for (i = 0; i < TILE_SIZE; i++)
+			{
+				result->payload[i] = (int32) (((days[i] + 6) % 7 + 7) % 7);
+			}
+			break;
+		case VOPS_FIELD_HOUR:
+			for (i = 0; i < TILE_SIZE; i++)
+			{
+				result->payload[i] = usecs ? (int32) (usecs[i] / USECS_PER_HOUR) : 0;
+			}
+			break;
+		case VOPS_FIELD_MINUTE:
+			for (i = 0; i < TILE_SIZE; i++)
+			{
+				result->payload[i] = usecs ? (int32) (usecs[i] / USECS_PER_MINUTE % MINS_PER_HOUR) : 0;
+			}
+			break;
+		default:
+			for (i = 0; i < TILE_SIZE; i++)
+			{
+				if (days[i] < month_start || days[i] >= month_end)
+				{
+					vops_day_to_civil(days[i], &year, &month, &mday);
+					month_start = days[i] - mday + 1;
+					month_end = month == 12 ? vops_civil_to_day(year + 1, 1, 1) : vops_civil_to_day(year, month + 1, 1);
+				}
+				switch (field)
+				{
+					case VOPS_FIELD_YEAR:
+						result->payload[i] = year;
+						break;
+					case VOPS_FIELD_QUARTER:
+						result->payload[i] = (month - 1) / 3 + 1;
+						break;
+					case VOPS_FIELD_MONTH:
+						result->payload[i] = month;
+						break;
+					case VOPS_FIELD_DAY:
+						result->payload[i] = (int32) (days[i] - month_start + 1);
+						break;
+					case VOPS_FIELD_DOY:
+						result->payload[i] = (int32) (days[i] - vops_civil_to_day(year, 1, 1) + 1);
+						break;
+					default:
+						Assert(false);
+				}
+			}
+	}
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(vops_date_part_date);
+Datum
+vops_date_part_date(PG_FUNCTION_ARGS)
+{
+	vops_date_field field = vops_get_date_field(PG_GETARG_TEXT_PP(0));
+	vops_int4  *date = (vops_int4 *) PG_GETARG_POINTER(1);
+	int64		days[TILE_SIZE];
+	int			i;
+
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		days[i] = date->payload[i];
+	}
+	PG_RETURN_POINTER(vops_date_part_tile(field, date->hdr, days, NULL));
+}
+
+PG_FUNCTION_INFO_V1(vops_date_part_timestamp);
+Datum
+vops_date_part_timestamp(PG_FUNCTION_ARGS)
+{
+	vops_date_field field = vops_get_date_field(PG_GETARG_TEXT_PP(0));
+	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
+	int64		days[TILE_SIZE];
+	int64		usecs[TILE_SIZE];
+	int			i;
+
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		days[i] = vops_timestamp_day(timestamp->payload[i]);
+		usecs[i] = timestamp->payload[i] - days[i] * USECS_PER_DAY;
+	}
+	PG_RETURN_POINTER(vops_date_part_tile(field, timestamp->hdr, days, usecs));
+}
+
+PG_FUNCTION_INFO_V1(vops_date_part_timestamptz);
+Datum
+vops_date_part_timestamptz(PG_FUNCTION_ARGS)
+{
+	vops_date_field field = vops_get_date_field(PG_GETARG_TEXT_PP(0));
+	vops_int8  *timestamp = (vops_int8 *) PG_GETARG_POINTER(1);
+	uint64		mask = ~(timestamp->hdr.empty_mask | timestamp->hdr.null_mask);
+	vops_tz_offsets offs;
+	int64		days[TILE_SIZE];
+	int64		usecs[TILE_SIZE];
+	int			i;
+
+	vops_tz_offsets_init(&offs, timestamp, session_timezone);
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		Timestamp	local = (mask & ((uint64) 1 << i))
+			? timestamp->payload[i] + vops_tz_offset(&offs, timestamp->payload[i])
+			: 0;
+
+		days[i] = vops_timestamp_day(local);
+		usecs[i] = local - days[i] * USECS_PER_DAY;
+	}
+	PG_RETURN_POINTER(vops_date_part_tile(field, timestamp->hdr, days, usecs));
+}
+
+
 
 
-
 static EState *estate;
 static TupleTableSlot *slot;
 static Relation rel;
@@ -1834,7 +2715,7 @@ PG_FUNCTION_INFO_V1(vops_text_approxdc_accumulate);
 Datum
 vops_text_approxdc_accumulate(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(1);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(1);
 	vops_tile_hdr *opd = VOPS_TEXT_TILE(var);
 	vops_approxdc_state *state = PG_ARGISNULL(1) ? NULL : (vops_approxdc_state *) PG_GETARG_POINTER(1);
 	uint64		mask = filter_mask & ~opd->empty_mask & ~opd->null_mask;
@@ -1894,6 +2775,7 @@ vops_text_approxdc_accumulate(PG_FUNCTION_ARGS)
 	IFNULL_OP(TYPE,CTYPE,GXTYPE)							\
 	CONST_OP(TYPE,CTYPE,GXTYPE)								\
 	COALESCE_OP(TYPE,GXTYPE)								\
+	IF_OP(TYPE,CTYPE,GXTYPE)								\
 	SUM_AGG(TYPE,STYPE,GSTYPE)								\
 	SUM_WIN(TYPE,SSTYPE,STYPE)								\
 	AVG_WIN(TYPE)											\
@@ -1924,11 +2806,91 @@ REGISTER_TYPE(int8, int8, int64, int64, long64, Int64, INT64, INT64, INT64, lld,
 REGISTER_TYPE(float4, float8, float4, float8, float8, Float4, FLOAT4, FLOAT8, FLOAT8, lg, Max(1, FLT_DIG + extra_float_digits))
 REGISTER_TYPE(float8, float8, float8, float8, float8, Float8, FLOAT8, FLOAT8, FLOAT8, lg, Max(1, DBL_DIG + extra_float_digits))
 
+SEND_FUNC(char, pq_sendbyte)
+SEND_FUNC(int2, PQ_SENDINT16)
+SEND_FUNC(int4, PQ_SENDINT32)
+SEND_FUNC(int8, pq_sendint64)
+SEND_FUNC(float4, pq_sendfloat4)
+SEND_FUNC(float8, pq_sendfloat8)
+
+RECV_FUNC(char, char, pq_getmsgbyte)
+RECV_FUNC(int2, int16, PQ_GETMSGINT16)
+RECV_FUNC(int4, int32, PQ_GETMSGINT32)
+RECV_FUNC(int8, int64, pq_getmsgint64)
+RECV_FUNC(float4, float4, pq_getmsgfloat4)
+RECV_FUNC(float8, float8, pq_getmsgfloat8)
+
 REGISTER_BIN_OP(char, rem, %, char, CHAR)
 REGISTER_BIN_OP(int2, rem, %, int32, INT32)
 REGISTER_BIN_OP(int4, rem, %, int32, INT32)
 REGISTER_BIN_OP(int8, rem, %, int64, INT64)
 
+#define REGISTER_INT_MATH(TYPE,CTYPE,XTYPE,GXTYPE)			\
+	MATH_FUNC(TYPE,abs,Abs,NEGATIVE_RESULT,ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE,"value out of range") \
+	MINMAX_FUNC(TYPE,CTYPE,XTYPE,GXTYPE,greatest,>)			\
+	MINMAX_FUNC(TYPE,CTYPE,XTYPE,GXTYPE,least,<)
+
+#define REGISTER_FLOAT_MATH(TYPE,CTYPE,XTYPE,GXTYPE)		\
+	REGISTER_INT_MATH(TYPE,CTYPE,XTYPE,GXTYPE)				\
+	MATH_FUNC(TYPE,round,rint,NO_CHECK,ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE,"value out of range") \
+	MATH_FUNC(TYPE,floor,floor,NO_CHECK,ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE,"value out of range") \
+	MATH_FUNC(TYPE,ceil,ceil,NO_CHECK,ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE,"value out of range") \
+	MATH_FUNC(TYPE,sqrt,sqrt,NEGATIVE_ARG,ERRCODE_INVALID_ARGUMENT_FOR_POWER_FUNCTION,"cannot take square root of a negative number") \
+	MATH_FUNC(TYPE,ln,log,NON_POSITIVE_ARG,ERRCODE_INVALID_ARGUMENT_FOR_LOG,"cannot take logarithm of zero or a negative number") \
+	MATH_FUNC(TYPE,exp,exp,OVERFLOW_RESULT,ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE,"value out of range: overflow") \
+	MATH_BIN_FUNC(TYPE,XTYPE,GXTYPE,power,pow,INVALID_POWER,ERRCODE_INVALID_ARGUMENT_FOR_POWER_FUNCTION,"invalid argument for power function",OVERFLOW_POWER)
+
+REGISTER_INT_MATH(int2, int16, int32, INT32)
+REGISTER_INT_MATH(int4, int32, int32, INT32)
+REGISTER_INT_MATH(int8, int64, int64, INT64)
+REGISTER_FLOAT_MATH(float4, float4, float8, FLOAT8)
+REGISTER_FLOAT_MATH(float8, float8, float8, FLOAT8)
+
+CAST_FUNC(int2, int4, int2, int4, int32, NO_CONV, NO_OVERFLOW, "integer out of range")
+CAST_FUNC(int2, int8, int2, int8, int64, NO_CONV, NO_OVERFLOW, "bigint out of range")
+CAST_FUNC(int2, float4, int2, float4, float4, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(int2, float8, int2, float8, float8, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(int4, int2, int4, int2, int16, NO_CONV, INT16_OVERFLOW, "smallint out of range")
+CAST_FUNC(int4, int8, int4, int8, int64, NO_CONV, NO_OVERFLOW, "bigint out of range")
+CAST_FUNC(int4, float4, int4, float4, float4, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(int4, float8, int4, float8, float8, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(int8, int2, int8, int2, int16, NO_CONV, INT16_OVERFLOW, "smallint out of range")
+CAST_FUNC(int8, int4, int8, int4, int32, NO_CONV, INT32_OVERFLOW, "integer out of range")
+CAST_FUNC(int8, float4, int8, float4, float4, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(int8, float8, int8, float8, float8, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(float4, int2, float4, int2, int16, rint, FLOAT_INT16_OVERFLOW, "smallint out of range")
+CAST_FUNC(float4, int4, float4, int4, int32, rint, FLOAT_INT32_OVERFLOW, "integer out of range")
+CAST_FUNC(float4, int8, float4, int8, int64, rint, FLOAT_INT64_OVERFLOW, "bigint out of range")
+CAST_FUNC(float4, float8, float4, float8, float8, NO_CONV, NO_OVERFLOW, "value out of range")
+CAST_FUNC(float8, int2, float8, int2, int16, rint, FLOAT_INT16_OVERFLOW, "smallint out of range")
+CAST_FUNC(float8, int4, float8, int4, int32, rint, FLOAT_INT32_OVERFLOW, "integer out of range")
+CAST_FUNC(float8, int8, float8, int8, int64, rint, FLOAT_INT64_OVERFLOW, "bigint out of range")
+CAST_FUNC(float8, float4, float8, float4, float4, NO_CONV, FLOAT4_OVERFLOW, "value out of range: overflow")
+
+CAST_FUNC(date, timestamp, int4, int8, int64, DATE_TO_TIMESTAMP, NO_OVERFLOW, "timestamp out of range")
+CAST_FUNC(timestamp, date, int8, int4, int32, TIMESTAMP_TO_DATE, NO_OVERFLOW, "date out of range")
+
+#define REGISTER_MIXED_OPS(LTYPE,RTYPE,RESTYPE,CTYPE)		\
+	MIXED_BIN_OP(LTYPE,RTYPE,RESTYPE,CTYPE,add,+)			\
+	MIXED_BIN_OP(LTYPE,RTYPE,RESTYPE,CTYPE,sub,-)			\
+	MIXED_BIN_OP(LTYPE,RTYPE,RESTYPE,CTYPE,mul,*)			\
+	MIXED_BIN_OP(LTYPE,RTYPE,RESTYPE,CTYPE,div,/)			\
+	MIXED_BIN_OP(RTYPE,LTYPE,RESTYPE,CTYPE,add,+)			\
+	MIXED_BIN_OP(RTYPE,LTYPE,RESTYPE,CTYPE,sub,-)			\
+	MIXED_BIN_OP(RTYPE,LTYPE,RESTYPE,CTYPE,mul,*)			\
+	MIXED_BIN_OP(RTYPE,LTYPE,RESTYPE,CTYPE,div,/)
+
+REGISTER_MIXED_OPS(int2, int4, int4, int32)
+REGISTER_MIXED_OPS(int2, int8, int8, int64)
+REGISTER_MIXED_OPS(int2, float4, float4, float4)
+REGISTER_MIXED_OPS(int2, float8, float8, float8)
+REGISTER_MIXED_OPS(int4, int8, int8, int64)
+REGISTER_MIXED_OPS(int4, float4, float4, float4)
+REGISTER_MIXED_OPS(int4, float8, float8, float8)
+REGISTER_MIXED_OPS(int8, float4, float4, float4)
+REGISTER_MIXED_OPS(int8, float8, float8, float8)
+REGISTER_MIXED_OPS(float4, float8, float8, float8)
+
 
 PG_FUNCTION_INFO_V1(vops_deltatime_output);
 Datum
@@ -2113,6 +3075,68 @@ vops_text_output(PG_FUNCTION_ARGS)
 	PG_RETURN_CSTRING(buf);
 }
 
+/*
+ * Strings are sent as fixed size elements (width followed by raw tile body),
+ * so tile is transferred without any parsing.
+ */
+PG_FUNCTION_INFO_V1(vops_text_send);
+Datum
+vops_text_send(PG_FUNCTION_ARGS)
+{
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
+	vops_tile_hdr *tile = VOPS_TEXT_TILE(var);
+	int			width = VOPS_ELEM_SIZE(var);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	PQ_SENDINT32(&buf, width);
+	pq_sendint64(&buf, tile->null_mask);
+	pq_sendint64(&buf, tile->empty_mask);
+	pq_sendbytes(&buf, (char *) (tile + 1), width * TILE_SIZE);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(vops_text_recv);
+Datum
+vops_text_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	int32		typmod = PG_GETARG_INT32(2);
+	int			width = pq_getmsgint(buf, 4);
+	int			dst_width = typmod > 0 ? typmod : width;
+	struct varlena *var;
+	vops_tile_hdr *result;
+	char const *src;
+	char	   *dst;
+	int			i;
+
+	if (width <= 0 || width > (buf->len - buf->cursor) / TILE_SIZE)
+		elog(ERROR, "Invalid vops_text width");
+
+	var = vops_alloc_text(dst_width);
+	result = VOPS_TEXT_TILE(var);
+	result->null_mask = pq_getmsgint64(buf);
+	result->empty_mask = pq_getmsgint64(buf);
+	src = pq_getmsgbytes(buf, width * TILE_SIZE);
+	dst = (char *) (result + 1);
+	if (width == dst_width)
+	{
+		memcpy(dst, src, width * TILE_SIZE);
+	}
+	else
+	{
+		/* convert to the width of the target column */
+		for (i = 0; i < TILE_SIZE; i++, src += width, dst += dst_width)
+		{
+			int			len = strnlen(src, Min(width, dst_width));
+
+			memcpy(dst, src, len);
+			memset(dst + len, '\0', dst_width - len);
+		}
+	}
+	PG_RETURN_POINTER(var);
+}
+
 PG_FUNCTION_INFO_V1(vops_text_typmod_in);
 Datum
 vops_text_typmod_in(PG_FUNCTION_ARGS)
@@ -2132,8 +3156,8 @@ vops_text_typmod_in(PG_FUNCTION_ARGS)
 PG_FUNCTION_INFO_V1(vops_text_##op);									\
 Datum vops_text_##op(PG_FUNCTION_ARGS)									\
 {																		\
-	struct varlena* vl = PG_GETARG_VARLENA_PP(0);						\
-	struct varlena* vr = PG_GETARG_VARLENA_PP(1);						\
+	struct varlena* vl = PG_GETARG_VOPS_TEXT(0);						\
+	struct varlena* vr = PG_GETARG_VOPS_TEXT(1);						\
 	vops_tile_hdr* left = VOPS_TEXT_TILE(vl);							\
 	vops_tile_hdr* right = VOPS_TEXT_TILE(vl);							\
 	size_t left_elem_size = VOPS_ELEM_SIZE(vl);							\
@@ -2166,7 +3190,7 @@ Datum vops_text_##op(PG_FUNCTION_ARGS)									\
 PG_FUNCTION_INFO_V1(vops_text_##op##_rconst);							\
 Datum vops_text_##op##_rconst(PG_FUNCTION_ARGS)							\
 {																		\
-	struct varlena* var = PG_GETARG_VARLENA_PP(0);						\
+	struct varlena* var = PG_GETARG_VOPS_TEXT(0);						\
 	text* t = PG_GETARG_TEXT_P(1);										\
 	vops_tile_hdr* left = VOPS_TEXT_TILE(var);							\
 	size_t elem_size = VOPS_ELEM_SIZE(var);								\
@@ -2201,7 +3225,7 @@ Datum vops_text_##op##_rconst(PG_FUNCTION_ARGS)							\
 PG_FUNCTION_INFO_V1(vops_text_##op##_lconst);							\
 Datum vops_text_##op##_lconst(PG_FUNCTION_ARGS)							\
 {																		\
-	struct varlena* var = PG_GETARG_VARLENA_PP(1);						\
+	struct varlena* var = PG_GETARG_VOPS_TEXT(1);						\
 	text* t = PG_GETARG_TEXT_P(0);										\
 	vops_tile_hdr* right = VOPS_TEXT_TILE(var);							\
 	size_t elem_size = VOPS_ELEM_SIZE(var);								\
@@ -2276,8 +3300,8 @@ PG_FUNCTION_INFO_V1(vops_text_concat);
 Datum
 vops_text_concat(PG_FUNCTION_ARGS)
 {
-	struct varlena *vl = PG_GETARG_VARLENA_PP(0);
-	struct varlena *vr = PG_GETARG_VARLENA_PP(1);
+	struct varlena *vl = PG_GETARG_VOPS_TEXT(0);
+	struct varlena *vr = PG_GETARG_VOPS_TEXT(1);
 	vops_tile_hdr *left = VOPS_TEXT_TILE(vl);
 	vops_tile_hdr *right = VOPS_TEXT_TILE(vl);
 	size_t		left_elem_size = VOPS_ELEM_SIZE(vl);
@@ -2303,7 +3327,7 @@ PG_FUNCTION_INFO_V1(vops_betwixt_text);
 Datum
 vops_betwixt_text(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	text	   *from = PG_GETARG_TEXT_P(1);
 	text	   *till = PG_GETARG_TEXT_P(2);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
@@ -2343,7 +3367,7 @@ PG_FUNCTION_INFO_V1(vops_ifnull_text);
 Datum
 vops_ifnull_text(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *opd = VOPS_TEXT_TILE(var);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
 	text	   *subst = PG_GETARG_TEXT_P(1);
@@ -2383,11 +3407,11 @@ PG_FUNCTION_INFO_V1(vops_coalesce_text);
 Datum
 vops_coalesce_text(PG_FUNCTION_ARGS)
 {
-	struct varlena *left = PG_GETARG_VARLENA_PP(0);
+	struct varlena *left = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *opd = VOPS_TEXT_TILE(left);
 	size_t		elem_size = VOPS_ELEM_SIZE(left);
 
-	struct varlena *right = PG_GETARG_VARLENA_PP(1);
+	struct varlena *right = PG_GETARG_VOPS_TEXT(1);
 	vops_tile_hdr *subst = VOPS_TEXT_TILE(right);
 	size_t		subst_elem_size = VOPS_ELEM_SIZE(right);
 
@@ -2417,11 +3441,61 @@ vops_coalesce_text(PG_FUNCTION_ARGS)
 	PG_RETURN_POINTER(result);
 }
 
+PG_FUNCTION_INFO_V1(vops_if_text);
+Datum
+vops_if_text(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	struct varlena *vl = PG_GETARG_VOPS_TEXT(1);
+	struct varlena *vr = PG_GETARG_VOPS_TEXT(2);
+	vops_tile_hdr *left = VOPS_TEXT_TILE(vl);
+	vops_tile_hdr *right = VOPS_TEXT_TILE(vr);
+	size_t		elem_size = VOPS_ELEM_SIZE(vl);
+	struct varlena *result;
+	vops_tile_hdr *res;
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+	char	   *dst;
+	char const *l = (char *) (left + 1);
+	char const *r = (char *) (right + 1);
+	int			i;
+
+	if (VOPS_ELEM_SIZE(vr) != elem_size)
+		elog(ERROR, "Branches of conditional expression should have the same width");
+
+	result = vops_alloc_text(elem_size);
+	res = VOPS_TEXT_TILE(result);
+	dst = (char *) (res + 1);
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		memcpy(dst + elem_size * i, ((mask >> i) & 1) ? l + elem_size * i : r + elem_size * i, elem_size);
+	}
+	res->null_mask = (left->null_mask & mask) | (right->null_mask & ~mask);
+	res->empty_mask = cond->hdr.empty_mask | left->empty_mask | right->empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(vops_if_text_else_null);
+Datum
+vops_if_text_else_null(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	struct varlena *vl = PG_GETARG_VOPS_TEXT(1);
+	vops_tile_hdr *left = VOPS_TEXT_TILE(vl);
+	struct varlena *result = (struct varlena *) palloc(VARSIZE(vl));
+	vops_tile_hdr *res = VOPS_TEXT_TILE(result);
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+
+	memcpy(result, vl, VARSIZE(vl));
+	res->null_mask = left->null_mask | ~mask;
+	res->empty_mask = cond->hdr.empty_mask | left->empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
 PG_FUNCTION_INFO_V1(vops_text_first);
 Datum
 vops_text_first(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *tile = VOPS_TEXT_TILE(var);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
 
@@ -2448,7 +3522,7 @@ PG_FUNCTION_INFO_V1(vops_text_last);
 Datum
 vops_text_last(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *tile = VOPS_TEXT_TILE(var);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
 
@@ -2475,7 +3549,7 @@ PG_FUNCTION_INFO_V1(vops_text_low);
 Datum
 vops_text_low(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *tile = VOPS_TEXT_TILE(var);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
 
@@ -2515,7 +3589,7 @@ PG_FUNCTION_INFO_V1(vops_text_high);
 Datum
 vops_text_high(PG_FUNCTION_ARGS)
 {
-	struct varlena *var = PG_GETARG_VARLENA_PP(0);
+	struct varlena *var = PG_GETARG_VOPS_TEXT(0);
 	vops_tile_hdr *tile = VOPS_TEXT_TILE(var);
 	size_t		elem_size = VOPS_ELEM_SIZE(var);
 
@@ -2556,7 +3630,7 @@ Datum
 vops_text_first_accumulate(PG_FUNCTION_ARGS)
 {
 	vops_first_state *state = (vops_first_state *) PG_GETARG_POINTER(0);
-	struct varlena *vars = PG_GETARG_VARLENA_PP(1);
+	struct varlena *vars = PG_GETARG_VOPS_TEXT(1);
 	vops_int8  *tss = (vops_int8 *) PG_GETARG_POINTER(2);
 
 	if (state == NULL)
@@ -2627,7 +3701,7 @@ Datum
 vops_text_last_accumulate(PG_FUNCTION_ARGS)
 {
 	vops_first_state *state = (vops_first_state *) PG_GETARG_POINTER(0);
-	struct varlena *vars = PG_GETARG_VARLENA_PP(1);
+	struct varlena *vars = PG_GETARG_VOPS_TEXT(1);
 	vops_int8  *tss = (vops_int8 *) PG_GETARG_POINTER(2);
 
 	if (state == NULL)
@@ -2772,21 +3846,1581 @@ vops_last_combine(PG_FUNCTION_ARGS)
 }
 
 
-static const size_t vops_sizeof[] =
+/*
+ * vops_numeric: decimal values stored as 64-bit integers multiplied by 10^scale.
+ * Scale is stored in the tile, so operands with different scales can be combined.
+ */
+#define VOPS_NUMERIC_MAX_SCALE 18
+
+static const int64 vops_pow10[VOPS_NUMERIC_MAX_SCALE + 1] =
 {
-	sizeof(vops_bool),
-	sizeof(vops_char),
-	sizeof(vops_int2),
-	sizeof(vops_int4),
-	sizeof(vops_int8),
-	sizeof(vops_int4),
+	INT64CONST(1),
+	INT64CONST(10),
+	INT64CONST(100),
+	INT64CONST(1000),
+	INT64CONST(10000),
+	INT64CONST(100000),
+	INT64CONST(1000000),
+	INT64CONST(10000000),
+	INT64CONST(100000000),
+	INT64CONST(1000000000),
+	INT64CONST(10000000000),
+	INT64CONST(100000000000),
+	INT64CONST(1000000000000),
+	INT64CONST(10000000000000),
+	INT64CONST(100000000000000),
+	INT64CONST(1000000000000000),
+	INT64CONST(10000000000000000),
+	INT64CONST(100000000000000000),
+	INT64CONST(1000000000000000000)
+};
+
+#ifdef HAVE_INT128
+typedef int128 vops_numeric_acc;
+#else
+typedef int64 vops_numeric_acc;
+#endif
+
+typedef struct
+{
+	vops_numeric_acc sum;
+	uint64		count;
+	int32		scale;
+} vops_numeric_sum_state;
+
+#define VOPS_NUMERIC_SCALE(typmod) (((typmod) - VARHDRSZ) & 0xffff)
+#define VOPS_NUMERIC_PRECISION(typmod) ((((typmod) - VARHDRSZ) >> 16) & 0xffff)
+
+/*
+ * Change scale of the value, rounding it if scale is decreased
+ */
+static int64
+vops_numeric_rescale(int64 val, int from_scale, int to_scale)
+{
+	if (to_scale > from_scale)
+	{
+		int64		result;
+
+		if (to_scale - from_scale > VOPS_NUMERIC_MAX_SCALE
+			|| pg_mul_s64_overflow(val, vops_pow10[to_scale - from_scale], &result))
+			elog(ERROR, "vops_numeric value out of range");
+		return result;
+	}
+	else if (to_scale < from_scale)
+	{
+		int64		div = vops_pow10[from_scale - to_scale];
+		int64		quot = val / div;
+		int64		rem = val % div;
+
+		if (rem >= (div + 1) / 2)
+			quot += 1;
+		else if (rem <= -(div + 1) / 2)
+			quot -= 1;
+		return quot;
+	}
+	return val;
+}
+
+/*
+ * Compare values with different scales. Values are not rescaled to the common scale in int64,
+ * because it can overflow for valid values.
+ */
+static int
+vops_numeric_cmp(int64 left, int left_scale, int64 right, int right_scale)
+{
+#ifdef HAVE_INT128
+	int128		l = (int128) left * (left_scale < right_scale ? vops_pow10[right_scale - left_scale] : 1);
+	int128		r = (int128) right * (right_scale < left_scale ? vops_pow10[left_scale - right_scale] : 1);
+#else
+	int64		l = left;
+	int64		r = right;
+
+	/* Rescaled value doesn't fit in int64, so it is larger by magnitude than other one */
+	if (left_scale < right_scale && pg_mul_s64_overflow(left, vops_pow10[right_scale - left_scale], &l))
+		return left < 0 ? -1 : 1;
+	if (right_scale < left_scale && pg_mul_s64_overflow(right, vops_pow10[left_scale - right_scale], &r))
+		return right < 0 ? 1 : -1;
+#endif
+	return l < r ? -1 : l > r ? 1 : 0;
+}
+
+/*
+ * Parse decimal number. If scale is negative, then it is determined by number of fractional digits.
+ * Returns pointer to the first character after the number.
+ */
+static char const *
+vops_numeric_parse(char const *str, int64 *result, int *scale)
+{
+	char const *src = str;
+	bool		negative = false;
+	bool		overflow = false;
+	int64		val = 0;
+	int			n_digits = 0;
+	int			n_fraction = 0;
+	int			round_digit = 0;
+
+	if (*scale > VOPS_NUMERIC_MAX_SCALE)
+		elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+	while (isspace((unsigned char) *src))
+		src += 1;
+	if (*src == '-' || *src == '+')
+		negative = *src++ == '-';
+	while (isdigit((unsigned char) *src))
+	{
+		overflow |= pg_mul_s64_overflow(val, 10, &val);
+		overflow |= pg_add_s64_overflow(val, *src++ - '0', &val);
+		n_digits += 1;
+	}
+	if (*src == '.')
+	{
+		src += 1;
+		while (isdigit((unsigned char) *src))
+		{
+			if (*scale < 0 || n_fraction < *scale)
+			{
+				overflow |= pg_mul_s64_overflow(val, 10, &val);
+				overflow |= pg_add_s64_overflow(val, *src - '0', &val);
+				n_fraction += 1;
+			}
+			else if (round_digit == 0)
+			{
+				/* only the first truncated digit is relevant for rounding */
+				round_digit = *src - '0' >= 5 ? 1 : -1;
+			}
+			src += 1;
+			n_digits += 1;
+		}
+	}
+	if (n_digits == 0)
+		elog(ERROR, "Failed to parse vops_numeric value '%s'", str);
+	if (*scale < 0)
+	{
+		if (n_fraction > VOPS_NUMERIC_MAX_SCALE)
+			elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+		*scale = n_fraction;
+	}
+	else if (n_fraction < *scale)
+	{
+		overflow |= pg_mul_s64_overflow(val, vops_pow10[*scale - n_fraction], &val);
+	}
+	if (round_digit > 0)
+		overflow |= pg_add_s64_overflow(val, 1, &val);
+	if (overflow)
+		elog(ERROR, "vops_numeric value '%s' is out of range", str);
+	*result = negative ? -val : val;
+	return src;
+}
+
+static void
+vops_numeric_format(StringInfo str, int64 val, int scale)
+{
+	char		buf[32];
+	int			len;
+	uint64		abs_val = val < 0 ? -(uint64) val : (uint64) val;
+
+	len = snprintf(buf, sizeof(buf), "%0*llu", scale + 1, (unsigned long long) abs_val);
+	if (val < 0)
+		appendStringInfoChar(str, '-');
+	appendBinaryStringInfo(str, buf, len - scale);
+	if (scale > 0)
+	{
+		appendStringInfoChar(str, '.');
+		appendBinaryStringInfo(str, buf + len - scale, scale);
+	}
+}
+
+/*
+ * On-disk format of numeric (see numeric.c): header followed by base 10000 digits.
+ * Short header contains sign, display scale and weight, long header is followed by weight.
+ */
+#define VOPS_NBASE                      10000
+#define VOPS_DEC_DIGITS                 4
+#define VOPS_NUMERIC_SIGN_MASK          0xC000
+#define VOPS_NUMERIC_NEG                0x4000
+#define VOPS_NUMERIC_SHORT              0x8000
+#define VOPS_NUMERIC_SPECIAL            0xC000
+#define VOPS_NUMERIC_DSCALE_MASK        0x3FFF
+#define VOPS_NUMERIC_SHORT_SIGN_MASK    0x2000
+#define VOPS_NUMERIC_SHORT_DSCALE_MASK  0x1F80
+#define VOPS_NUMERIC_SHORT_DSCALE_SHIFT 7
+#define VOPS_NUMERIC_SHORT_WEIGHT_SIGN_MASK 0x0040
+#define VOPS_NUMERIC_SHORT_WEIGHT_MASK  0x003F
+
+/*
+ * Convert scaled integer to numeric datum.
+ * Value fits in int64, so it always can be represented in short format.
+ */
+Datum
+vops_numeric_get_datum(int64 val, int scale)
+{
+	uint64		abs_val = val < 0 ? -(uint64) val : (uint64) val;
+	uint64		int_part = abs_val / vops_pow10[scale];
+	uint64		frac_part = abs_val % vops_pow10[scale];
+	int16		digits[(20 + VOPS_NUMERIC_MAX_SCALE) / VOPS_DEC_DIGITS + 2];
+	int			n_int = 0;
+	int			n_frac = (scale + VOPS_DEC_DIGITS - 1) / VOPS_DEC_DIGITS;
+	int			first;
+	int			last;
+	int			weight;
+	int			i;
+	uint16		header;
+	Numeric		result;
+
+	/* Integer digits are produced from the least significant one */
+	for (; int_part != 0; int_part /= VOPS_NBASE)
+		n_int += 1;
+	int_part = abs_val / vops_pow10[scale];
+	for (i = n_int; --i >= 0; int_part /= VOPS_NBASE)
+		digits[i] = (int16) (int_part % VOPS_NBASE);
+	for (i = 0; i < n_frac; i++)
+	{
+		int			rest = scale - (i + 1) * VOPS_DEC_DIGITS;	/* decimal digits after this group */
+
+		digits[n_int + i] = rest >= 0
+			? (int16) (frac_part / vops_pow10[rest] % VOPS_NBASE)
+			: (int16) (frac_part % vops_pow10[VOPS_DEC_DIGITS + rest] * vops_pow10[-rest]);
+	}
+	/* Strip leading and trailing zero digits */
+	first = 0;
+	last = n_int + n_frac;
+	while (first < last && digits[first] == 0)
+		first += 1;
+	while (last > first && digits[last - 1] == 0)
+		last -= 1;
+	weight = first == last ? 0 : n_int - 1 - first;
+
+	result = (Numeric) palloc(VARHDRSZ + sizeof(uint16) + (last - first) * sizeof(int16));
+	SET_VARSIZE(result, VARHDRSZ + sizeof(uint16) + (last - first) * sizeof(int16));
+	header = VOPS_NUMERIC_SHORT
+		| (val < 0 ? VOPS_NUMERIC_SHORT_SIGN_MASK : 0)
+		| (scale << VOPS_NUMERIC_SHORT_DSCALE_SHIFT)
+		| (weight < 0 ? VOPS_NUMERIC_SHORT_WEIGHT_SIGN_MASK : 0)
+		| (weight & VOPS_NUMERIC_SHORT_WEIGHT_MASK);
+	memcpy(VARDATA(result), &header, sizeof(uint16));
+	memcpy(VARDATA(result) + sizeof(uint16), &digits[first], (last - first) * sizeof(int16));
+	return NumericGetDatum(result);
+}
+
+/*
+ * Convert numeric datum to scaled integer, rounding it to the specified scale.
+ * If scale is negative, then it is assigned display scale of numeric value.
+ */
+static int64
+vops_numeric_from_datum(Datum datum, int *scale)
+{
+	Numeric		num = DatumGetNumeric(datum);
+	char	   *data = VARDATA(num);
+	uint16		header;
+	int16		digit;
+	int			n_digits;
+	int			weight;
+	int			dscale;
+	bool		negative;
+	bool		overflow = false;
+	int64		val = 0;
+	int			i;
+
+	memcpy(&header, data, sizeof(uint16));
+	if ((header & VOPS_NUMERIC_SIGN_MASK) == VOPS_NUMERIC_SPECIAL)
+		elog(ERROR, "NaN and infinity can not be stored in vops_numeric");
+	if (header & VOPS_NUMERIC_SHORT)
+	{
+		negative = (header & VOPS_NUMERIC_SHORT_SIGN_MASK) != 0;
+		dscale = (header & VOPS_NUMERIC_SHORT_DSCALE_MASK) >> VOPS_NUMERIC_SHORT_DSCALE_SHIFT;
+		weight = ((header & VOPS_NUMERIC_SHORT_WEIGHT_SIGN_MASK) ? ~VOPS_NUMERIC_SHORT_WEIGHT_MASK : 0)
+			| (header & VOPS_NUMERIC_SHORT_WEIGHT_MASK);
+		data += sizeof(uint16);
+	}
+	else
+	{
+		int16		long_weight;
+
+		negative = (header & VOPS_NUMERIC_SIGN_MASK) == VOPS_NUMERIC_NEG;
+		dscale = header & VOPS_NUMERIC_DSCALE_MASK;
+		memcpy(&long_weight, data + sizeof(uint16), sizeof(int16));
+		weight = long_weight;
+		data += sizeof(uint16) + sizeof(int16);
+	}
+	n_digits = (VARSIZE(num) - (data - (char *) num)) / sizeof(int16);
+
+	if (*scale < 0)
+	{
+		if (dscale > VOPS_NUMERIC_MAX_SCALE)
+			elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+		*scale = dscale;
+	}
+	else if (*scale > VOPS_NUMERIC_MAX_SCALE)
+		elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+
+	for (i = 0; i < n_digits; i++)
+	{
+		int			exp10 = (weight - i) * VOPS_DEC_DIGITS + *scale;	/* position of digit in scaled value */
+
+		memcpy(&digit, data + i * sizeof(int16), sizeof(int16));
+		if (exp10 >= 0)
+		{
+			int64		term;
+
+			if (digit != 0)
+				overflow |= exp10 > VOPS_NUMERIC_MAX_SCALE
+					|| pg_mul_s64_overflow(digit, vops_pow10[exp10], &term)
+					|| pg_add_s64_overflow(val, term, &val);
+		}
+		else
+		{
+			/* Digit is beyond the scale: round half away from zero as numeric does */
+			bool		round_up;
+
+			if (exp10 > -VOPS_DEC_DIGITS)
+			{
+				int64		div = vops_pow10[-exp10];
+
+				overflow |= pg_add_s64_overflow(val, digit / div, &val);
+				round_up = (digit % div) * 2 >= div;
+			}
+			else
+				round_up = exp10 == -VOPS_DEC_DIGITS && digit * 2 >= VOPS_NBASE;
+			if (round_up)
+				overflow |= pg_add_s64_overflow(val, 1, &val);
+			break;
+		}
+	}
+	if (overflow)
+		elog(ERROR, "numeric value is out of range of vops_numeric");
+	return negative ? -val : val;
+}
+
+static vops_numeric *
+vops_numeric_alloc(int scale)
+{
+	vops_numeric *result = (vops_numeric *) palloc0(sizeof(vops_numeric));
+
+	result->scale = scale;
+	return result;
+}
+
+/*
+ * Fill tile with numeric constant
+ */
+static void
+vops_numeric_fill(vops_numeric *tile, Datum num)
+{
+	int			scale = -1;
+	int64		val = vops_numeric_from_datum(num, &scale);
+	int			i;
+
+	for (i = 0; i < TILE_SIZE; i++)
+		tile->payload[i] = val;
+	tile->hdr.null_mask = 0;
+	tile->hdr.empty_mask = 0;
+	tile->scale = scale;
+}
+
+/*
+ * Coerce tile to the specified typmod: round values to the target scale and check precision
+ */
+static vops_numeric *
+vops_numeric_apply_typmod(vops_numeric *tile, int32 typmod)
+{
+	vops_numeric *result;
+	int			scale;
+	int			precision;
+	uint64		mask;
+	int			i;
+
+	if (typmod < (int32) VARHDRSZ)
+		return tile;
+
+	scale = VOPS_NUMERIC_SCALE(typmod);
+	precision = VOPS_NUMERIC_PRECISION(typmod);
+	if (scale > VOPS_NUMERIC_MAX_SCALE)
+		elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+	result = vops_numeric_alloc(scale);
+	result->hdr = tile->hdr;
+	mask = ~(tile->hdr.null_mask | tile->hdr.empty_mask);
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (mask & ((uint64) 1 << i))
+		{
+			int64		val = vops_numeric_rescale(tile->payload[i], tile->scale, scale);
+
+			if (precision <= VOPS_NUMERIC_MAX_SCALE && (val >= vops_pow10[precision] || val <= -vops_pow10[precision]))
+				elog(ERROR, "vops_numeric field overflow: precision %d, scale %d", precision, scale);
+			result->payload[i] = val;
+		}
+	}
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_input);
+Datum
+vops_numeric_input(PG_FUNCTION_ARGS)
+{
+	char const *str = PG_GETARG_CSTRING(0);
+	int32		typmod = PG_GETARG_INT32(2);
+	int			scale = typmod >= (int32) VARHDRSZ ? VOPS_NUMERIC_SCALE(typmod) : -1;
+	int64		val[TILE_SIZE];
+	int			scales[TILE_SIZE];
+	vops_numeric *result;
+	int			i;
+	int			max_scale = 0;
+
+	result = vops_numeric_alloc(0);
+	if (*str != '{')
+	{
+		int64		v;
+
+		if (*vops_numeric_parse(str, &v, &scale) != '\0')
+			elog(ERROR, "Failed to parse constant: '%s'", str);
+		for (i = 0; i < TILE_SIZE; i++)
+			result->payload[i] = v;
+		result->scale = scale;
+	}
+	else
+	{
+		/* scale of tile without typmod is maximal scale of its elements */
+		str += 1;
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			val[i] = 0;
+			scales[i] = scale;
+			if (*str == ',' || *str == '}')
+			{
+				result->hdr.empty_mask |= (uint64) 1 << i;
+				if (*str == ',')
+					str += 1;
+			}
+			else
+			{
+				if (*str == '?')
+				{
+					result->hdr.null_mask |= (uint64) 1 << i;
+					str += 1;
+				}
+				else
+				{
+					str = vops_numeric_parse(str, &val[i], &scales[i]);
+					if (scales[i] > max_scale)
+						max_scale = scales[i];
+				}
+				if (*str == ',')
+					str += 1;
+				else if (*str != '}')
+					elog(ERROR, "Failed to parse tile: separator expected '%s' found", str);
+			}
+		}
+		if (*str != '}')
+			elog(ERROR, "Failed to parse tile: unexpected trailing data '%s'", str);
+		result->scale = scale >= 0 ? scale : max_scale;
+		for (i = 0; i < TILE_SIZE; i++)
+			result->payload[i] = vops_numeric_rescale(val[i], scales[i] < 0 ? result->scale : scales[i], result->scale);
+	}
+	PG_RETURN_POINTER(vops_numeric_apply_typmod(result, typmod));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_output);
+Datum
+vops_numeric_output(PG_FUNCTION_ARGS)
+{
+	vops_numeric *tile = (vops_numeric *) PG_GETARG_POINTER(0);
+	StringInfoData str;
+	char		sep = '{';
+	int			i;
+
+	initStringInfo(&str);
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		appendStringInfoChar(&str, sep);
+		if (tile->hdr.empty_mask & ((uint64) 1 << i))
+		{
+			/* empty element */
+		}
+		else if (tile->hdr.null_mask & ((uint64) 1 << i))
+		{
+			appendStringInfoChar(&str, '?');
+		}
+		else
+		{
+			vops_numeric_format(&str, tile->payload[i], tile->scale);
+		}
+		sep = ',';
+	}
+	appendStringInfoChar(&str, '}');
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_send);
+Datum
+vops_numeric_send(PG_FUNCTION_ARGS)
+{
+	vops_numeric *tile = (vops_numeric *) PG_GETARG_POINTER(0);
+	StringInfoData buf;
+	int			i;
+
+	pq_begintypsend(&buf);
+	enlargeStringInfo(&buf, sizeof(vops_numeric));
+	PQ_SENDINT32(&buf, tile->scale);
+	pq_sendint64(&buf, tile->hdr.null_mask);
+	pq_sendint64(&buf, tile->hdr.empty_mask);
+	for (i = 0; i < TILE_SIZE; i++)
+		pq_sendint64(&buf, tile->payload[i]);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_recv);
+Datum
+vops_numeric_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	int32		typmod = PG_GETARG_INT32(2);
+	int			scale = (int32) pq_getmsgint(buf, 4);
+	vops_numeric *result;
+	int			i;
+
+	if (scale < 0 || scale > VOPS_NUMERIC_MAX_SCALE)
+		elog(ERROR, "Invalid vops_numeric scale %d", scale);
+	result = vops_numeric_alloc(scale);
+	result->hdr.null_mask = pq_getmsgint64(buf);
+	result->hdr.empty_mask = pq_getmsgint64(buf);
+	for (i = 0; i < TILE_SIZE; i++)
+		result->payload[i] = pq_getmsgint64(buf);
+	PG_RETURN_POINTER(vops_numeric_apply_typmod(result, typmod));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_typmod);
+Datum
+vops_numeric_typmod(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(vops_numeric_apply_typmod((vops_numeric *) PG_GETARG_POINTER(0), PG_GETARG_INT32(1)));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_const);
+Datum
+vops_numeric_const(PG_FUNCTION_ARGS)
+{
+	vops_numeric *result = vops_numeric_alloc(0);
+
+	vops_numeric_fill(result, PG_GETARG_DATUM(0));
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * Arithmetic operations with overflow check. Overflow is reported only for non-null elements.
+ */
+static vops_numeric *
+vops_numeric_arith(vops_numeric const *left, vops_numeric const *right, char op)
+{
+	vops_numeric *result;
+	uint64		overflow = 0;
+	int			i;
+
+	if (op == '*')
+	{
+		if (left->scale + right->scale > VOPS_NUMERIC_MAX_SCALE)
+			elog(ERROR, "vops_numeric scale can not exceed %d", VOPS_NUMERIC_MAX_SCALE);
+		result = vops_numeric_alloc(left->scale + right->scale);
+		for (i = 0; i < TILE_SIZE; i++)
+			overflow |= (uint64) pg_mul_s64_overflow(left->payload[i], right->payload[i], &result->payload[i]) << i;
+	}
+	else
+	{
+		int			scale = Max(left->scale, right->scale);
+		int64		lf = vops_pow10[scale - left->scale];
+		int64		rf = vops_pow10[scale - right->scale];
+
+		result = vops_numeric_alloc(scale);
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			int64		l,
+						r;
+			bool		ovf = pg_mul_s64_overflow(left->payload[i], lf, &l) | pg_mul_s64_overflow(right->payload[i], rf, &r);
+
+			if (op == '+')
+				ovf |= pg_add_s64_overflow(l, r, &result->payload[i]);
+			else
+				ovf |= pg_sub_s64_overflow(l, r, &result->payload[i]);
+			overflow |= (uint64) ovf << i;
+		}
+	}
+	result->hdr.null_mask = left->hdr.null_mask | right->hdr.null_mask;
+	result->hdr.empty_mask = left->hdr.empty_mask | right->hdr.empty_mask;
+	if (overflow & ~(result->hdr.null_mask | result->hdr.empty_mask))
+		elog(ERROR, "vops_numeric value out of range");
+	return result;
+}
+
+#define NUMERIC_BIN_OP(OP,COP)											\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP);								\
+	Datum vops_numeric_##OP(PG_FUNCTION_ARGS)							\
+	{																	\
+		vops_numeric* left = (vops_numeric*)PG_GETARG_POINTER(0);		\
+		vops_numeric* right = (vops_numeric*)PG_GETARG_POINTER(1);		\
+		PG_RETURN_POINTER(vops_numeric_arith(left, right, COP));		\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP##_rconst);					\
+	Datum vops_numeric_##OP##_rconst(PG_FUNCTION_ARGS)					\
+	{																	\
+		vops_numeric* left = (vops_numeric*)PG_GETARG_POINTER(0);		\
+		vops_numeric right;												\
+		vops_numeric_fill(&right, PG_GETARG_DATUM(1));					\
+		PG_RETURN_POINTER(vops_numeric_arith(left, &right, COP));		\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP##_lconst);					\
+	Datum vops_numeric_##OP##_lconst(PG_FUNCTION_ARGS)					\
+	{																	\
+		vops_numeric left;												\
+		vops_numeric* right = (vops_numeric*)PG_GETARG_POINTER(1);		\
+		vops_numeric_fill(&left, PG_GETARG_DATUM(0));					\
+		PG_RETURN_POINTER(vops_numeric_arith(&left, right, COP));		\
+	}
+
+#define NUMERIC_CMP_OP(OP,COP)											\
+	static vops_bool* vops_numeric_##OP##_tiles(vops_numeric const* left, vops_numeric const* right) \
+	{																	\
+		vops_bool* result = (vops_bool*)palloc(sizeof(vops_bool));		\
+		int i;															\
+		uint64 payload = 0;												\
+		result->hdr.null_mask = left->hdr.null_mask | right->hdr.null_mask;	\
+		result->hdr.empty_mask = left->hdr.empty_mask | right->hdr.empty_mask; \
+		if (left->scale == right->scale) {								\
+			for (i = 0; i < TILE_SIZE; i++) payload |= (uint64)(left->payload[i] COP right->payload[i]) << i; \
+		} else {														\
+			uint64 mask = ~(result->hdr.null_mask | result->hdr.empty_mask); \
+			for (i = 0; i < TILE_SIZE; i++) {							\
+				if (mask & ((uint64)1 << i)) {							\
+					payload |= (uint64)(vops_numeric_cmp(left->payload[i], left->scale, \
+														 right->payload[i], right->scale) COP 0) << i; \
+				}														\
+			}															\
+		}																\
+		result->payload = payload;										\
+		return result;													\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP);								\
+	Datum vops_numeric_##OP(PG_FUNCTION_ARGS)							\
+	{																	\
+		vops_numeric* left = (vops_numeric*)PG_GETARG_POINTER(0);		\
+		vops_numeric* right = (vops_numeric*)PG_GETARG_POINTER(1);		\
+		PG_RETURN_POINTER(vops_numeric_##OP##_tiles(left, right));		\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP##_rconst);					\
+	Datum vops_numeric_##OP##_rconst(PG_FUNCTION_ARGS)					\
+	{																	\
+		vops_numeric* left = (vops_numeric*)PG_GETARG_POINTER(0);		\
+		vops_numeric right;												\
+		vops_numeric_fill(&right, PG_GETARG_DATUM(1));					\
+		PG_RETURN_POINTER(vops_numeric_##OP##_tiles(left, &right));		\
+	}																	\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP##_lconst);					\
+	Datum vops_numeric_##OP##_lconst(PG_FUNCTION_ARGS)					\
+	{																	\
+		vops_numeric left;												\
+		vops_numeric* right = (vops_numeric*)PG_GETARG_POINTER(1);		\
+		vops_numeric_fill(&left, PG_GETARG_DATUM(0));					\
+		PG_RETURN_POINTER(vops_numeric_##OP##_tiles(&left, right));		\
+	}
+
+NUMERIC_BIN_OP(add, '+')
+NUMERIC_BIN_OP(sub, '-')
+NUMERIC_BIN_OP(mul, '*')
+
+NUMERIC_CMP_OP(eq, ==)
+NUMERIC_CMP_OP(ne, !=)
+NUMERIC_CMP_OP(lt, <)
+NUMERIC_CMP_OP(le, <=)
+NUMERIC_CMP_OP(gt, >)
+NUMERIC_CMP_OP(ge, >=)
+
+PG_FUNCTION_INFO_V1(vops_betwixt_numeric);
+Datum
+vops_betwixt_numeric(PG_FUNCTION_ARGS)
+{
+	vops_numeric *opd = (vops_numeric *) PG_GETARG_POINTER(0);
+	vops_numeric low;
+	vops_numeric high;
+	vops_bool  *result;
+
+	vops_numeric_fill(&low, PG_GETARG_DATUM(1));
+	vops_numeric_fill(&high, PG_GETARG_DATUM(2));
+	result = vops_numeric_ge_tiles(opd, &low);
+	result->payload &= vops_numeric_le_tiles(opd, &high)->payload;
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_neg);
+Datum
+vops_numeric_neg(PG_FUNCTION_ARGS)
+{
+	vops_numeric *opd = (vops_numeric *) PG_GETARG_POINTER(0);
+	vops_numeric *result = vops_numeric_alloc(opd->scale);
+	int			i;
+
+	for (i = 0; i < TILE_SIZE; i++)
+		result->payload[i] = -opd->payload[i];
+	result->hdr = opd->hdr;
+	PG_RETURN_POINTER(result);
+}
+
+static vops_numeric *
+vops_numeric_coalesce(vops_numeric const *opd, vops_numeric const *subst)
+{
+	int			scale = Max(opd->scale, subst->scale);
+	vops_numeric *result = vops_numeric_alloc(scale);
+	uint64		live;
+	int			i;
+
+	result->hdr.null_mask = opd->hdr.null_mask & subst->hdr.null_mask;
+	result->hdr.empty_mask = opd->hdr.empty_mask | subst->hdr.empty_mask;
+	live = ~(result->hdr.null_mask | result->hdr.empty_mask);
+
+	/* Only non-null elements are rescaled: garbage in other elements may overflow */
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (live & ((uint64) 1 << i))
+		{
+			result->payload[i] = (opd->hdr.null_mask & ((uint64) 1 << i))
+				? vops_numeric_rescale(subst->payload[i], subst->scale, scale)
+				: vops_numeric_rescale(opd->payload[i], opd->scale, scale);
+		}
+	}
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(vops_ifnull_numeric);
+Datum
+vops_ifnull_numeric(PG_FUNCTION_ARGS)
+{
+	vops_numeric *opd = (vops_numeric *) PG_GETARG_POINTER(0);
+	vops_numeric subst;
+
+	vops_numeric_fill(&subst, PG_GETARG_DATUM(1));
+	PG_RETURN_POINTER(vops_numeric_coalesce(opd, &subst));
+}
+
+PG_FUNCTION_INFO_V1(vops_coalesce_numeric);
+Datum
+vops_coalesce_numeric(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(vops_numeric_coalesce((vops_numeric *) PG_GETARG_POINTER(0), (vops_numeric *) PG_GETARG_POINTER(1)));
+}
+
+PG_FUNCTION_INFO_V1(vops_if_numeric);
+Datum
+vops_if_numeric(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	vops_numeric *left = (vops_numeric *) PG_GETARG_POINTER(1);
+	vops_numeric *right = (vops_numeric *) PG_GETARG_POINTER(2);
+	int			scale = Max(left->scale, right->scale);
+	vops_numeric *result = vops_numeric_alloc(scale);
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+	uint64		live;
+	int			i;
+
+	result->hdr.null_mask = (left->hdr.null_mask & mask) | (right->hdr.null_mask & ~mask);
+	result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask | right->hdr.empty_mask;
+	live = ~(result->hdr.null_mask | result->hdr.empty_mask);
+
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (live & ((uint64) 1 << i))
+		{
+			result->payload[i] = ((mask >> i) & 1)
+				? vops_numeric_rescale(left->payload[i], left->scale, scale)
+				: vops_numeric_rescale(right->payload[i], right->scale, scale);
+		}
+	}
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(vops_if_numeric_else_null);
+Datum
+vops_if_numeric_else_null(PG_FUNCTION_ARGS)
+{
+	vops_bool  *cond = (vops_bool *) PG_GETARG_POINTER(0);
+	vops_numeric *left = (vops_numeric *) PG_GETARG_POINTER(1);
+	vops_numeric *result = (vops_numeric *) palloc(sizeof(vops_numeric));
+	uint64		mask = cond->payload & ~cond->hdr.null_mask;
+
+	memcpy(result, left, sizeof(vops_numeric));
+	result->hdr.null_mask = left->hdr.null_mask | ~mask;
+	result->hdr.empty_mask = cond->hdr.empty_mask | left->hdr.empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * Sum and average of vops_numeric are calculated exactly and returned as numeric
+ */
+static void
+vops_numeric_sum_add(vops_numeric_sum_state *state, vops_numeric_acc sum, int scale)
+{
+	int			result_scale = Max(state->scale, scale);
+
+#ifdef HAVE_INT128
+	state->sum = state->sum * vops_pow10[result_scale - state->scale] + sum * vops_pow10[result_scale - scale];
+#else
+	if (pg_mul_s64_overflow(state->sum, vops_pow10[result_scale - state->scale], &state->sum)
+		|| pg_mul_s64_overflow(sum, vops_pow10[result_scale - scale], &sum)
+		|| pg_add_s64_overflow(state->sum, sum, &state->sum))
+		elog(ERROR, "vops_numeric sum out of range");
+#endif
+	state->scale = result_scale;
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_accumulate);
+Datum
+vops_numeric_sum_accumulate(PG_FUNCTION_ARGS)
+{
+	vops_numeric_sum_state *state = PG_ARGISNULL(0) ? NULL : (vops_numeric_sum_state *) PG_GETARG_POINTER(0);
+	vops_numeric *opd = (vops_numeric *) PG_GETARG_POINTER(1);
+	uint64		mask = filter_mask & ~opd->hdr.empty_mask & ~opd->hdr.null_mask;
+	vops_numeric_acc sum = 0;
+	int			i;
+
+	if (mask == 0)
+	{
+		if (state == NULL)
+			PG_RETURN_NULL();
+		PG_RETURN_POINTER(state);
+	}
+	if (state == NULL)
+	{
+		MemoryContext agg_context;
+
+		if (!AggCheckCallContext(fcinfo, &agg_context))
+			elog(ERROR, "aggregate function called in non-aggregate context");
+		state = (vops_numeric_sum_state *) MemoryContextAllocZero(agg_context, sizeof(vops_numeric_sum_state));
+		state->scale = opd->scale;
+	}
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (mask & ((uint64) 1 << i))
+		{
+#ifdef HAVE_INT128
+			sum += opd->payload[i];
+#else
+			if (pg_add_s64_overflow(sum, opd->payload[i], &sum))
+				elog(ERROR, "vops_numeric sum out of range");
+#endif
+			state->count += 1;
+		}
+	}
+	vops_numeric_sum_add(state, sum, opd->scale);
+	PG_RETURN_POINTER(state);
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_combine);
+Datum
+vops_numeric_sum_combine(PG_FUNCTION_ARGS)
+{
+	vops_numeric_sum_state *state0 = PG_ARGISNULL(0) ? NULL : (vops_numeric_sum_state *) PG_GETARG_POINTER(0);
+	vops_numeric_sum_state *state1 = PG_ARGISNULL(1) ? NULL : (vops_numeric_sum_state *) PG_GETARG_POINTER(1);
+
+	if (state0 == NULL)
+	{
+		if (state1 == NULL)
+		{
+			PG_RETURN_NULL();
+		}
+		else
+		{
+			MemoryContext agg_context;
+
+			if (!AggCheckCallContext(fcinfo, &agg_context))
+				elog(ERROR, "aggregate function called in non-aggregate context");
+			state0 = (vops_numeric_sum_state *) MemoryContextAllocZero(agg_context, sizeof(vops_numeric_sum_state));
+			*state0 = *state1;
+		}
+	}
+	else if (state1 != NULL)
+	{
+		vops_numeric_sum_add(state0, state1->sum, state1->scale);
+		state0->count += state1->count;
+	}
+	PG_RETURN_POINTER(state0);
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_serial);
+Datum
+vops_numeric_sum_serial(PG_FUNCTION_ARGS)
+{
+	vops_numeric_sum_state *state = (vops_numeric_sum_state *) PG_GETARG_POINTER(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+#ifdef HAVE_INT128
+	pq_sendint64(&buf, (int64) (state->sum >> 64));
+#endif
+	pq_sendint64(&buf, (int64) state->sum);
+	pq_sendint64(&buf, state->count);
+	pq_sendint64(&buf, state->scale);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_deserial);
+Datum
+vops_numeric_sum_deserial(PG_FUNCTION_ARGS)
+{
+	bytea	   *sstate = PG_GETARG_BYTEA_P(0);
+	vops_numeric_sum_state *state = (vops_numeric_sum_state *) palloc(sizeof(vops_numeric_sum_state));
+	StringInfoData buf;
+
+	initStringInfo(&buf);
+	appendBinaryStringInfo(&buf, VARDATA(sstate), VARSIZE(sstate) - VARHDRSZ);
+
+#ifdef HAVE_INT128
+	state->sum = (int128) pq_getmsgint64(&buf) << 64;
+	state->sum |= (uint64) pq_getmsgint64(&buf);
+#else
+	state->sum = pq_getmsgint64(&buf);
+#endif
+	state->count = pq_getmsgint64(&buf);
+	state->scale = (int32) pq_getmsgint64(&buf);
+
+	pq_getmsgend(&buf);
+	pfree(buf.data);
+
+	PG_RETURN_POINTER(state);
+}
+
+static Datum
+vops_numeric_sum_datum(vops_numeric_sum_state *state)
+{
+#ifdef HAVE_INT128
+	if (state->sum > PG_INT64_MAX || state->sum < PG_INT64_MIN)
+	{
+		/* value doesn't fit in int64: combine two parts */
+		Datum		high = vops_numeric_get_datum((int64) (state->sum / vops_pow10[VOPS_NUMERIC_MAX_SCALE]), state->scale);
+		Datum		low = vops_numeric_get_datum((int64) (state->sum % vops_pow10[VOPS_NUMERIC_MAX_SCALE]), state->scale);
+
+		return DirectFunctionCall2(numeric_add,
+								   DirectFunctionCall2(numeric_mul, high, vops_numeric_get_datum(vops_pow10[VOPS_NUMERIC_MAX_SCALE], 0)),
+								   low);
+	}
+#endif
+	return vops_numeric_get_datum((int64) state->sum, state->scale);
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_final);
+Datum
+vops_numeric_sum_final(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_DATUM(vops_numeric_sum_datum((vops_numeric_sum_state *) PG_GETARG_POINTER(0)));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_avg_final);
+Datum
+vops_numeric_avg_final(PG_FUNCTION_ARGS)
+{
+	vops_numeric_sum_state *state = (vops_numeric_sum_state *) PG_GETARG_POINTER(0);
+
+	PG_RETURN_DATUM(DirectFunctionCall2(numeric_div,
+										vops_numeric_sum_datum(state),
+										DirectFunctionCall1(int8_numeric, Int64GetDatum(state->count))));
+}
+
+#define NUMERIC_MINMAX_AGG(OP,COP,CMP_FUNC)								\
+	PG_FUNCTION_INFO_V1(vops_numeric_##OP##_accumulate);				\
+	Datum vops_numeric_##OP##_accumulate(PG_FUNCTION_ARGS)				\
+	{																	\
+		vops_numeric* opd = (vops_numeric*)PG_GETARG_POINTER(1);		\
+		uint64 mask = filter_mask & ~opd->hdr.empty_mask & ~opd->hdr.null_mask; \
+		int64 result = 0;												\
+		bool is_null = true;											\
+		Datum val;														\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			if (mask & ((uint64)1 << i)) {								\
+				if (is_null || opd->payload[i] COP result) {			\
+					result = opd->payload[i];							\
+					is_null = false;									\
+				}														\
+			}															\
+		}																\
+		if (is_null) {													\
+			if (PG_ARGISNULL(0)) PG_RETURN_NULL();						\
+			PG_RETURN_DATUM(PG_GETARG_DATUM(0));						\
+		}																\
+		val = vops_numeric_get_datum(result, opd->scale);				\
+		if (!PG_ARGISNULL(0)) {											\
+			val = DirectFunctionCall2(CMP_FUNC, PG_GETARG_DATUM(0), val); \
+		}																\
+		PG_RETURN_DATUM(val);											\
+	}
+
+NUMERIC_MINMAX_AGG(max, >, numeric_larger)
+NUMERIC_MINMAX_AGG(min, <, numeric_smaller)
+
+/*
+ * Cumulative window aggregates for vops_numeric. State is vops_numeric tile which
+ * scale is the maximal scale of aggregated tiles.
+ */
+static vops_numeric *
+vops_numeric_window_extend(FunctionCallInfo fcinfo, char op)
+{
+	vops_numeric *state = PG_ARGISNULL(0) ? NULL : (vops_numeric *) PG_GETARG_POINTER(0);
+	vops_numeric *val = PG_ARGISNULL(1) ? NULL : (vops_numeric *) PG_GETARG_POINTER(1);
+	int64		result;
+	int			scale;
+	bool		is_null;
+	int			i;
+
+	if (state == NULL)
+	{
+		MemoryContext agg_context;
+
+		if (!AggCheckCallContext(fcinfo, &agg_context))
+			elog(ERROR, "aggregate function called in non-aggregate context");
+		state = (vops_numeric *) MemoryContextAllocZero(agg_context, sizeof(vops_numeric));
+		state->hdr.null_mask = ~0;
+		state->scale = val != NULL ? val->scale : 0;
+	}
+	else
+	{
+		state->hdr.null_mask = (int64) state->hdr.null_mask >> 63;
+	}
+	is_null = state->hdr.null_mask != 0;
+	scale = val != NULL ? Max(state->scale, val->scale) : state->scale;
+	result = is_null ? 0 : vops_numeric_rescale(state->payload[TILE_SIZE - 1], state->scale, scale);
+	state->scale = scale;
+	state->hdr.empty_mask = ~filter_mask;
+	if (val == NULL)
+	{
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			state->payload[i] = result;
+		}
+	}
+	else
+	{
+		uint64		mask = filter_mask & ~val->hdr.empty_mask & ~val->hdr.null_mask;
+
+		state->hdr.empty_mask |= val->hdr.empty_mask;
+		for (i = 0; i < TILE_SIZE; i++)
+		{
+			if (mask & ((uint64) 1 << i))
+			{
+				int64		elem = vops_numeric_rescale(val->payload[i], val->scale, scale);
+
+				if (op == '+')
+				{
+					if (pg_add_s64_overflow(result, elem, &result))
+						elog(ERROR, "vops_numeric sum out of range");
+				}
+				else if (is_null || (op == '>' ? elem > result : elem < result))
+				{
+					result = elem;
+				}
+				is_null = false;
+				state->hdr.null_mask &= ((uint64) 1 << i) - 1;
+			}
+			state->payload[i] = result;
+		}
+	}
+	return state;
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_sum_extend);
+Datum
+vops_numeric_sum_extend(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(vops_numeric_window_extend(fcinfo, '+'));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_max_extend);
+Datum
+vops_numeric_max_extend(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(vops_numeric_window_extend(fcinfo, '>'));
+}
+
+PG_FUNCTION_INFO_V1(vops_numeric_min_extend);
+Datum
+vops_numeric_min_extend(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(vops_numeric_window_extend(fcinfo, '<'));
+}
+
+#define NUMERIC_SCALAR_FUNC(NAME,COND,CMP)								\
+	PG_FUNCTION_INFO_V1(vops_numeric_##NAME);							\
+	Datum vops_numeric_##NAME(PG_FUNCTION_ARGS)							\
+	{																	\
+		vops_numeric* tile = (vops_numeric*)PG_GETARG_POINTER(0);		\
+		uint64 mask = ~(tile->hdr.empty_mask | tile->hdr.null_mask);	\
+		int found = -1;													\
+		int i;															\
+		for (i = 0; i < TILE_SIZE; i++) {								\
+			if ((mask & ((uint64)1 << i)) && (found < 0 || (COND))) {	\
+				found = i;												\
+				if (CMP) break;											\
+			}															\
+		}																\
+		if (found < 0) {												\
+			PG_RETURN_NULL();											\
+		}																\
+		PG_RETURN_DATUM(vops_numeric_get_datum(tile->payload[found], tile->scale)); \
+	}
+
+NUMERIC_SCALAR_FUNC(first, false, true)
+NUMERIC_SCALAR_FUNC(last, true, false)
+NUMERIC_SCALAR_FUNC(low, tile->payload[i] < tile->payload[found], false)
+NUMERIC_SCALAR_FUNC(high, tile->payload[i] > tile->payload[found], false)
+
+static const size_t vops_sizeof[] =
+{
+	sizeof(vops_bool),
+	sizeof(vops_char),
+	sizeof(vops_int2),
+	sizeof(vops_int4),
+	sizeof(vops_int8),
+	sizeof(vops_int4),
+	sizeof(vops_int8),
 	sizeof(vops_int8),
 	sizeof(vops_float4),
 	sizeof(vops_float8),
 	sizeof(vops_int8),
-	0
+	0,
+	sizeof(vops_numeric)
 };
 
+/*
+ * Allocate tile of the specified type. Width of vops_text and scale of vops_numeric are taken from type->len
+ */
+static Datum
+vops_alloc_tile(vops_type_info const *type)
+{
+	switch (type->tid)
+	{
+		case VOPS_LAST:
+			return PointerGetDatum(NULL);
+		case VOPS_TEXT:
+			return PointerGetDatum(vops_alloc_text(type->len));
+		case VOPS_NUMERIC:
+			return PointerGetDatum(vops_numeric_alloc(type->len));
+		default:
+			return PointerGetDatum(palloc0(vops_sizeof[type->tid]));
+	}
+}
+
+/*
+ * Size of tile datum
+ */
+static Size
+vops_tile_size(Datum tile, vops_type tid)
+{
+	return tid == VOPS_TEXT ? VARSIZE(DatumGetPointer(tile)) : vops_sizeof[tid];
+}
+
+/*
+ * Calculate number of values and min/max of the column chunk
+ */
+static void
+vops_rowgroup_stats(vops_rowgroup_column *col, vops_tile_hdr *tile, vops_type tid)
+{
+	uint64		mask = ~(tile->empty_mask | tile->null_mask);
+	int			i;
+
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if (mask & ((uint64) 1 << i))
+		{
+			vops_value	val;
+
+			switch (tid)
+			{
+				case VOPS_CHAR:
+					val.i8 = ((vops_char *) tile)->payload[i];
+					break;
+				case VOPS_INT2:
+					val.i8 = ((vops_int2 *) tile)->payload[i];
+					break;
+				case VOPS_INT4:
+				case VOPS_DATE:
+					val.i8 = ((vops_int4 *) tile)->payload[i];
+					break;
+				case VOPS_INT8:
+				case VOPS_TIMESTAMP:
+				case VOPS_TIMESTAMPTZ:
+					val.i8 = ((vops_int8 *) tile)->payload[i];
+					break;
+				case VOPS_FLOAT4:
+					val.f8 = ((vops_float4 *) tile)->payload[i];
+					break;
+				case VOPS_FLOAT8:
+					val.f8 = ((vops_float8 *) tile)->payload[i];
+					break;
+				default:
+					/* no min/max for this type */
+					col->n_values += 1;
+					continue;
+			}
+			if (col->n_values++ == 0)
+			{
+				col->low = col->high = val;
+			}
+			else if (is_vops_type_integer(tid))
+			{
+				if (val.i8 < col->low.i8)
+					col->low = val;
+				if (val.i8 > col->high.i8)
+					col->high = val;
+			}
+			else
+			{
+				if (val.f8 < col->low.f8)
+					col->low = val;
+				if (val.f8 > col->high.f8)
+					col->high = val;
+			}
+		}
+	}
+}
+
+/*
+ * Pack tiles of several columns in one row group
+ */
+static Datum
+vops_form_rowgroup(int n_columns, char **names, vops_type_info *types, Datum *tiles)
+{
+	Size		offset = MAXALIGN(VOPS_ROWGROUP_HDRSZ + n_columns * sizeof(vops_rowgroup_column));
+	Size		size = offset;
+	vops_rowgroup *rg;
+	int			i;
+
+	for (i = 0; i < n_columns; i++)
+	{
+		size += MAXALIGN(vops_tile_size(tiles[i], types[i].tid));
+	}
+	rg = (vops_rowgroup *) palloc0(size);
+	SET_VARSIZE(rg, size);
+	rg->n_columns = n_columns;
+	for (i = 0; i < n_columns; i++)
+	{
+		vops_rowgroup_column *col = &rg->columns[i];
+		Size		chunk_size = vops_tile_size(tiles[i], types[i].tid);
+
+		namestrcpy(&col->name, names[i]);
+		col->type = types[i].dst_type;
+		col->typmod = types[i].tid == VOPS_TEXT ? types[i].len : -1;
+		col->offset = offset;
+		col->size = chunk_size;
+		vops_rowgroup_stats(col, VOPS_GET_TILE(tiles[i], types[i].tid), types[i].tid);
+		memcpy((char *) rg + offset, DatumGetPointer(tiles[i]), chunk_size);
+		offset += MAXALIGN(chunk_size);
+	}
+	return PointerGetDatum(rg);
+}
+
+/*
+ * Read directory of row group. Only the beginning of the row group is fetched,
+ * so column chunks stored in external TOAST are not accessed.
+ */
+vops_rowgroup_column *
+vops_rowgroup_directory(Datum rowgroup, int *n_columns)
+{
+	struct varlena *prefix = PG_DETOAST_DATUM_SLICE(rowgroup, 0,
+													VOPS_ROWGROUP_HDRSZ - VARHDRSZ + VOPS_ROWGROUP_PREFETCH_COLUMNS * sizeof(vops_rowgroup_column));
+	vops_rowgroup_column *dir;
+	int32		n;
+	Size		dir_size;
+
+	memcpy(&n, VARDATA(prefix), sizeof(int32));
+	dir_size = n * sizeof(vops_rowgroup_column);
+	dir = (vops_rowgroup_column *) palloc(dir_size);
+	if (n > VOPS_ROWGROUP_PREFETCH_COLUMNS)
+	{
+		pfree(prefix);
+		prefix = PG_DETOAST_DATUM_SLICE(rowgroup, VOPS_ROWGROUP_HDRSZ - VARHDRSZ, dir_size);
+		memcpy(dir, VARDATA(prefix), dir_size);
+	}
+	else
+	{
+		memcpy(dir, VARDATA(prefix) + VOPS_ROWGROUP_HDRSZ - VARHDRSZ, dir_size);
+	}
+	pfree(prefix);
+	*n_columns = n;
+	return dir;
+}
+
+/*
+ * Extract tile of the column from row group. Only the chunk of this column is fetched.
+ */
+Datum
+vops_rowgroup_chunk(Datum rowgroup, vops_rowgroup_column const *column)
+{
+	struct varlena *slice = PG_DETOAST_DATUM_SLICE(rowgroup, column->offset - VARHDRSZ, column->size);
+
+	/* Move chunk to the beginning of palloc'ed (and so properly aligned) buffer */
+	memmove(slice, VARDATA(slice), column->size);
+	return PointerGetDatum(slice);
+}
+
+PG_FUNCTION_INFO_V1(vops_rowgroup_output);
+Datum
+vops_rowgroup_output(PG_FUNCTION_ARGS)
+{
+	Datum		rg = PG_GETARG_DATUM(0);
+	int			i,
+				n_columns;
+	vops_rowgroup_column *dir = vops_rowgroup_directory(rg, &n_columns);
+	StringInfoData str;
+
+	initStringInfo(&str);
+	appendStringInfoChar(&str, '(');
+	for (i = 0; i < n_columns; i++)
+	{
+		Oid			typoutput;
+		bool		typisvarlena;
+
+		getTypeOutputInfo(dir[i].type, &typoutput, &typisvarlena);
+		appendStringInfo(&str, "%s%s %s %s",
+						 i == 0 ? "" : ", ",
+						 quote_identifier(NameStr(dir[i].name)),
+						 format_type_with_typemod(dir[i].type, dir[i].typmod),
+						 OidOutputFunctionCall(typoutput, vops_rowgroup_chunk(rg, &dir[i])));
+	}
+	appendStringInfoChar(&str, ')');
+	PG_RETURN_CSTRING(str.data);
+}
+
+/*
+ * Row group literal has format (name type {tile}, ...)
+ */
+PG_FUNCTION_INFO_V1(vops_rowgroup_input);
+Datum
+vops_rowgroup_input(PG_FUNCTION_ARGS)
+{
+	char const *str = PG_GETARG_CSTRING(0);
+	char const *src = str;
+	int			n_columns = 0;
+	int			max_columns = 8;
+	char	  **names = (char **) palloc(sizeof(char *) * max_columns);
+	vops_type_info *types = (vops_type_info *) palloc(sizeof(vops_type_info) * max_columns);
+	Datum	   *tiles = (Datum *) palloc(sizeof(Datum) * max_columns);
+	StringInfoData buf;
+
+	initStringInfo(&buf);
+	while (isspace((unsigned char) *src))
+		src += 1;
+	if (*src++ != '(')
+		elog(ERROR, "Failed to parse row group '%s': '(' expected", str);
+
+	while (true)
+	{
+		Oid			typid;
+		int32		typmod;
+		Oid			typinput;
+		Oid			typioparam;
+		char const *end;
+
+		while (isspace((unsigned char) *src))
+			src += 1;
+		if (*src == ')')
+			break;
+		if (n_columns == max_columns)
+		{
+			max_columns *= 2;
+			names = (char **) repalloc(names, sizeof(char *) * max_columns);
+			types = (vops_type_info *) repalloc(types, sizeof(vops_type_info) * max_columns);
+			tiles = (Datum *) repalloc(tiles, sizeof(Datum) * max_columns);
+		}
+		/* column name */
+		resetStringInfo(&buf);
+		if (*src == '"')
+		{
+			while (*++src != '\0' && !(*src == '"' && src[1] != '"'))
+			{
+				if (*src == '"')
+					src += 1;	/* doubled quote */
+				appendStringInfoChar(&buf, *src);
+			}
+			if (*src++ != '"')
+				elog(ERROR, "Failed to parse row group '%s': unterminated column name", str);
+		}
+		else
+		{
+			while (*src != '\0' && !isspace((unsigned char) *src))
+				appendStringInfoChar(&buf, *src++);
+		}
+		names[n_columns] = pstrdup(buf.data);
+
+		/* tile type */
+		while (isspace((unsigned char) *src))
+			src += 1;
+		for (end = src; *end != '\0' && !isspace((unsigned char) *end); end++);
+		if (end == src)
+			elog(ERROR, "Failed to parse row group '%s': type of column %s expected", str, names[n_columns]);
+		resetStringInfo(&buf);
+		appendBinaryStringInfo(&buf, src, end - src);
+#if PG_VERSION_NUM>=160000
+		parseTypeString(buf.data, &typid, &typmod, NULL);
+#else
+		parseTypeString(buf.data, &typid, &typmod, false);
+#endif
+		types[n_columns].dst_type = typid;
+		types[n_columns].tid = vops_get_type(typid);
+		types[n_columns].len = typmod;
+		if (types[n_columns].tid == VOPS_LAST)
+			elog(ERROR, "Row group can contain only VOPS tiles, but column %s has type %s", names[n_columns], buf.data);
+		if (types[n_columns].tid == VOPS_TEXT && typmod <= 0)
+			elog(ERROR, "Width of vops_text column %s is not specified", names[n_columns]);
+
+		/* tile literal */
+		src = end;
+		while (isspace((unsigned char) *src))
+			src += 1;
+		if (*src != '{' || (end = strchr(src, '}')) == NULL)
+			elog(ERROR, "Failed to parse row group '%s': tile of column %s expected", str, names[n_columns]);
+		resetStringInfo(&buf);
+		appendBinaryStringInfo(&buf, src, end - src + 1);
+		getTypeInputInfo(typid, &typinput, &typioparam);
+		tiles[n_columns] = OidInputFunctionCall(typinput, buf.data, typioparam, typmod);
+		n_columns += 1;
+
+		src = end + 1;
+		while (isspace((unsigned char) *src))
+			src += 1;
+		if (*src == ',')
+			src += 1;
+		else if (*src != ')')
+			elog(ERROR, "Failed to parse row group '%s': separator expected '%s' found", str, src);
+	}
+	src += 1;
+	while (isspace((unsigned char) *src))
+		src += 1;
+	if (*src != '\0')
+		elog(ERROR, "Failed to parse row group: unexpected trailing data '%s'", src);
+
+	PG_RETURN_DATUM(vops_form_rowgroup(n_columns, names, types, tiles));
+}
+
+/*
+ * Locate directory entry of the row group column with the specified name
+ */
+static vops_rowgroup_column *
+vops_rowgroup_find_column(Datum rowgroup, char const *name)
+{
+	int			i,
+				n_columns;
+	vops_rowgroup_column *dir = vops_rowgroup_directory(rowgroup, &n_columns);
+
+	for (i = 0; i < n_columns; i++)
+	{
+		if (strcmp(NameStr(dir[i].name), name) == 0)
+			return &dir[i];
+	}
+	elog(ERROR, "Row group has no column %s", name);
+	return NULL;				/* keep compiler quiet */
+}
+
+/*
+ * Extract tile of the specified column from row group.
+ * Type of the result is determined by the type of third (template) argument:
+ *    rowgroup_column(rg, 'price', null::vops_float4)
+ */
+PG_FUNCTION_INFO_V1(vops_rowgroup_get_column);
+Datum
+vops_rowgroup_get_column(PG_FUNCTION_ARGS)
+{
+	Oid			tile_type = get_fn_expr_argtype(fcinfo->flinfo, 2);
+	char	   *name;
+	vops_rowgroup_column *col;
+
+	if (PG_ARGISNULL(0) || PG_ARGISNULL(1))
+		PG_RETURN_NULL();
+
+	name = text_to_cstring(PG_GETARG_TEXT_PP(1));
+	col = vops_rowgroup_find_column(PG_GETARG_DATUM(0), name);
+	if (col->type != tile_type)
+		elog(ERROR, "Column %s of row group has type %s, but %s is requested",
+			 name, format_type_be(col->type), format_type_be(tile_type));
+	PG_RETURN_DATUM(vops_rowgroup_chunk(PG_GETARG_DATUM(0), col));
+}
+
+/*
+ * Get min/max of row group column from the directory, without fetching column chunk.
+ * Type of the result is determined by the type of third (template) argument which should be
+ * scalar type of the column:
+ *    rowgroup_low(rg, 'price', null::real)
+ */
+static Datum
+vops_rowgroup_bound(PG_FUNCTION_ARGS, bool high)
+{
+	Oid			result_type = get_fn_expr_argtype(fcinfo->flinfo, 2);
+	char	   *name;
+	vops_rowgroup_column *col;
+	vops_type	tid;
+	vops_value	val;
+
+	if (PG_ARGISNULL(0) || PG_ARGISNULL(1))
+		PG_RETURN_NULL();
+
+	name = text_to_cstring(PG_GETARG_TEXT_PP(1));
+	col = vops_rowgroup_find_column(PG_GETARG_DATUM(0), name);
+	tid = vops_get_type(col->type);
+	if (vops_map_tid[tid] != result_type)
+		elog(ERROR, "Column %s of row group has type %s, but %s is requested",
+			 name, format_type_be(col->type), format_type_be(result_type));
+	if (col->n_values == 0)
+		PG_RETURN_NULL();
+
+	val = high ? col->high : col->low;
+	switch (tid)
+	{
+		case VOPS_CHAR:
+			PG_RETURN_CHAR((char) val.i8);
+		case VOPS_INT2:
+			PG_RETURN_INT16((int16) val.i8);
+		case VOPS_INT4:
+		case VOPS_DATE:
+			PG_RETURN_INT32((int32) val.i8);
+		case VOPS_INT8:
+		case VOPS_TIMESTAMP:
+		case VOPS_TIMESTAMPTZ:
+			PG_RETURN_INT64(val.i8);
+		case VOPS_FLOAT4:
+			PG_RETURN_FLOAT4((float4) val.f8);
+		case VOPS_FLOAT8:
+			PG_RETURN_FLOAT8(val.f8);
+		default:
+			/* no min/max for this type */
+			PG_RETURN_NULL();
+	}
+}
+
+PG_FUNCTION_INFO_V1(vops_rowgroup_low);
+Datum
+vops_rowgroup_low(PG_FUNCTION_ARGS)
+{
+	return vops_rowgroup_bound(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(vops_rowgroup_high);
+Datum
+vops_rowgroup_high(PG_FUNCTION_ARGS)
+{
+	return vops_rowgroup_bound(fcinfo, true);
+}
+
+/*
+ * Insert tuple constructed by populate, packing tiles of row group columns (if any)
+ */
+static void
+vops_populate_insert(Datum *values, bool *nulls, vops_type_info *types, int n_attrs,
+					 int rowgroup_attno, char **packed_names, int n_packed)
+{
+	if (rowgroup_attno >= 0)
+	{
+		values[rowgroup_attno] = vops_form_rowgroup(n_packed, packed_names, types + n_attrs, values + n_attrs);
+		insert_tuple(values, nulls);
+		pfree(DatumGetPointer(values[rowgroup_attno]));
+	}
+	else
+	{
+		insert_tuple(values, nulls);
+	}
+}
+
 PG_FUNCTION_INFO_V1(vops_populate);
 Datum
 vops_populate(PG_FUNCTION_ARGS)
@@ -2800,7 +5434,11 @@ vops_populate(PG_FUNCTION_ARGS)
 	TupleDesc	spi_tupdesc;
 	int			i,
 				j,
-				n_attrs;
+				n_attrs,
+				n_columns;
+	int			n_packed = 0;
+	int			rowgroup_attno = -1;
+	char	  **packed_names = NULL;
 	vops_type_info *types;
 	Datum	   *values;
 	bool	   *nulls;
@@ -2820,6 +5458,23 @@ vops_populate(PG_FUNCTION_ARGS)
 		self_oid = fcinfo->flinfo->fn_oid;
 	}
 
+	/* Source columns packed in row group */
+	if (PG_NARGS() > 4 && !PG_ARGISNULL(4))
+	{
+		Datum	   *elems;
+		bool	   *elem_nulls;
+
+		deconstruct_array(PG_GETARG_ARRAYTYPE_P(4), TEXTOID, -1, false, 'i',
+						  &elems, &elem_nulls, &n_packed);
+		packed_names = (char **) palloc(sizeof(char *) * n_packed);
+		for (i = 0; i < n_packed; i++)
+		{
+			if (elem_nulls[i])
+				elog(ERROR, "Name of row group column can not be NULL");
+			packed_names[i] = TextDatumGetCString(elems[i]);
+		}
+	}
+
 	SPI_connect();
 	sql = psprintf("select attname,atttypid,atttypmod from pg_attribute where attrelid=%d and attnum>0 order by attnum", destination);
 	rc = SPI_execute(sql, true, 0);
@@ -2834,9 +5489,11 @@ vops_populate(PG_FUNCTION_ARGS)
 			 get_namespace_name(get_rel_namespace(destination)),
 			 get_rel_name(destination));
 	}
-	types = (vops_type_info *) palloc(sizeof(vops_type_info) * n_attrs);
-	values = (Datum *) palloc(sizeof(Datum) * n_attrs);
-	nulls = (bool *) palloc0(sizeof(bool) * n_attrs);
+	/* Tiles of row group columns are placed after destination attributes */
+	n_columns = n_attrs + n_packed;
+	types = (vops_type_info *) palloc(sizeof(vops_type_info) * n_columns);
+	values = (Datum *) palloc(sizeof(Datum) * n_columns);
+	nulls = (bool *) palloc0(sizeof(bool) * n_columns);
 
 	initStringInfo(&stmt);
 	appendStringInfo(&stmt, "select");
@@ -2848,6 +5505,19 @@ vops_populate(PG_FUNCTION_ARGS)
 		char const *name = SPI_getvalue(spi_tuple, spi_tupdesc, 1);
 		Oid			type_id = DatumGetObjectId(SPI_getbinval(spi_tuple, spi_tupdesc, 2, &is_null));
 
+		if (vops_is_rowgroup_type(type_id))
+		{
+			if (rowgroup_attno >= 0)
+				elog(ERROR, "Table %s contains more than one row group column", get_rel_name(destination));
+			rowgroup_attno = i;
+			types[i].dst_type = type_id;
+			types[i].tid = VOPS_LAST;
+			/* Keep positions of destination attributes in the select list */
+			appendStringInfo(&stmt, "%cnull", sep);
+			sep = ',';
+			SPI_freetuple(spi_tuple);
+			continue;
+		}
 		types[i].dst_type = type_id;
 		types[i].tid = vops_get_type(type_id);
 		get_typlenbyvalalign(type_id, &types[i].len, &types[i].byval, &types[i].align);
@@ -2860,12 +5530,31 @@ vops_populate(PG_FUNCTION_ARGS)
 				elog(ERROR, "Size of column %s is unknown", name);
 			}
 		}
+		else if (types[i].tid == VOPS_NUMERIC)
+		{
+			int32		typmod = DatumGetInt32(SPI_getbinval(spi_tuple, spi_tupdesc, 3, &is_null));
+
+			if (typmod < (int32) VARHDRSZ)
+			{
+				elog(ERROR, "Scale of column %s is not specified", name);
+			}
+			types[i].len = VOPS_NUMERIC_SCALE(typmod);
+		}
 		appendStringInfo(&stmt, "%c%s", sep, name);
 		sep = ',';
 		SPI_freetuple(spi_tuple);
 	}
 	SPI_freetuptable(SPI_tuptable);
 
+	if (rowgroup_attno >= 0 && n_packed == 0)
+		elog(ERROR, "Columns of row group are not specified");
+	if (rowgroup_attno < 0 && n_packed != 0)
+		elog(ERROR, "Table %s has no row group column", get_rel_name(destination));
+	for (i = 0; i < n_packed; i++)
+	{
+		appendStringInfo(&stmt, ",%s", packed_names[i]);
+	}
+
 	appendStringInfo(&stmt, " from %s.%s",
 					 get_namespace_name(get_rel_namespace(source)),
 					 get_rel_name(source));
@@ -2888,7 +5577,7 @@ vops_populate(PG_FUNCTION_ARGS)
 
 	for (i = 0; i < n_attrs; i++)
 	{
-		values[i] = PointerGetDatum(types[i].tid != VOPS_LAST ? types[i].tid == VOPS_TEXT ? vops_alloc_text(types[i].len) : palloc0(vops_sizeof[types[i].tid]) : NULL);
+		values[i] = vops_alloc_tile(&types[i]);
 	}
 
 	for (j = 0, loaded = 0;; j++, loaded++)
@@ -2906,6 +5595,8 @@ vops_populate(PG_FUNCTION_ARGS)
 					Oid			dst_type = types[i].dst_type;
 					Oid			src_type = SPI_gettypeid(spi_tupdesc, i + 1);
 
+					if (i == rowgroup_attno)
+						continue;
 					types[i].src_type = src_type;
 					if (types[i].tid != VOPS_LAST)
 						dst_type = vops_map_tid[types[i].tid];
@@ -2918,11 +5609,36 @@ vops_populate(PG_FUNCTION_ARGS)
 							 i + 1, format_type_be(dst_type), format_type_be(src_type));
 					}
 				}
+				/* Tile types of row group columns are derived from types of source columns */
+				for (i = n_attrs; i < n_columns; i++)
+				{
+					Form_pg_attribute attr = TupleDescAttr(spi_tupdesc, i);
+
+					types[i].src_type = attr->atttypid;
+					types[i].tid = vops_map_scalar_type(attr->atttypid);
+					if (types[i].tid == VOPS_LAST)
+						elog(ERROR, "Type %s of row group column %s is not supported",
+							 format_type_be(attr->atttypid), packed_names[i - n_attrs]);
+					types[i].dst_type = vops_get_tile_type(attr->atttypid);
+					if (types[i].tid == VOPS_TEXT)
+					{
+						types[i].len = attr->atttypmod - VARHDRSZ;
+						if (types[i].len <= 0)
+							elog(ERROR, "Size of column %s is unknown", packed_names[i - n_attrs]);
+					}
+					else if (types[i].tid == VOPS_NUMERIC)
+					{
+						if (attr->atttypmod < (int32) VARHDRSZ)
+							elog(ERROR, "Scale of column %s is not specified", packed_names[i - n_attrs]);
+						types[i].len = VOPS_NUMERIC_SCALE(attr->atttypmod);
+					}
+					values[i] = vops_alloc_tile(&types[i]);
+				}
 				type_checked = true;
 			}
 			if (j == TILE_SIZE)
 			{
-				for (i = 0; i < n_attrs; i++)
+				for (i = 0; i < n_columns; i++)
 				{
 					if (types[i].tid != VOPS_LAST)
 					{
@@ -2931,14 +5647,18 @@ vops_populate(PG_FUNCTION_ARGS)
 						tile->empty_mask = 0;
 					}
 				}
-				insert_tuple(values, nulls);
+				vops_populate_insert(values, nulls, types, n_attrs, rowgroup_attno, packed_names, n_packed);
 				j = 0;
 			}
 	Pack:
-			for (i = 0; i < n_attrs; i++)
+			for (i = 0; i < n_columns; i++)
 			{
-				Datum		val = SPI_getbinval(spi_tuple, spi_tupdesc, i + 1, &is_null);
+				Datum		val;
 
+				if (i == rowgroup_attno)
+					continue;
+
+				val = SPI_getbinval(spi_tuple, spi_tupdesc, i + 1, &is_null);
 				if (types[i].tid == VOPS_LAST)
 				{
 					if (j == 0)
@@ -2961,7 +5681,7 @@ vops_populate(PG_FUNCTION_ARGS)
 							 || !(is_null || datumIsEqual(values[i], val, types[i].byval, types[i].len)))
 					{
 						/* Mark unassigned elements as empty */
-						for (i = 0; i < n_attrs; i++)
+						for (i = 0; i < n_columns; i++)
 						{
 							if (types[i].tid != VOPS_LAST)
 							{
@@ -2970,7 +5690,7 @@ vops_populate(PG_FUNCTION_ARGS)
 								tile->empty_mask = (uint64) ~0 << j;
 							}
 						}
-						insert_tuple(values, nulls);
+						vops_populate_insert(values, nulls, types, n_attrs, rowgroup_attno, packed_names, n_packed);
 						j = 0;
 						goto Pack;
 					}
@@ -3001,6 +5721,7 @@ vops_populate(PG_FUNCTION_ARGS)
 							break;
 						case VOPS_INT8:
 						case VOPS_TIMESTAMP:
+						case VOPS_TIMESTAMPTZ:
 							((vops_int8 *) tile)->payload[j] = DatumGetInt64(val);
 							break;
 						case VOPS_FLOAT4:
@@ -3036,6 +5757,13 @@ vops_populate(PG_FUNCTION_ARGS)
 								}
 								break;
 							}
+						case VOPS_NUMERIC:
+							{
+								int			scale = ((vops_numeric *) tile)->scale;
+
+								((vops_numeric *) tile)->payload[j] = is_null ? 0 : vops_numeric_from_datum(val, &scale);
+								break;
+							}
 						default:
 							Assert(false);
 					}
@@ -3054,7 +5782,7 @@ vops_populate(PG_FUNCTION_ARGS)
 		if (j != TILE_SIZE)
 		{
 			/* Mark unassigned elements as empty */
-			for (i = 0; i < n_attrs; i++)
+			for (i = 0; i < n_columns; i++)
 			{
 				if (types[i].tid != VOPS_LAST)
 				{
@@ -3064,7 +5792,7 @@ vops_populate(PG_FUNCTION_ARGS)
 				}
 			}
 		}
-		insert_tuple(values, nulls);
+		vops_populate_insert(values, nulls, types, n_attrs, rowgroup_attno, packed_names, n_packed);
 	}
 	end_batch_insert();
 
@@ -3151,6 +5879,14 @@ vops_import(PG_FUNCTION_ARGS)
 			{
 				elog(ERROR, "Size of column %s is unknown", name);
 			}
+			if (types[i].tid == VOPS_NUMERIC)
+			{
+				if (types[i].len < (int32) VARHDRSZ)
+				{
+					elog(ERROR, "Scale of column %s is not specified", name);
+				}
+				types[i].len = VOPS_NUMERIC_SCALE(types[i].len);
+			}
 		}
 		getTypeInputInfo(type_id, &input_oid, &types[i].inproc_param_oid);
 		fmgr_info_cxt(input_oid, &types[i].inproc, fcinfo->flinfo->fn_mcxt);
@@ -3160,7 +5896,7 @@ vops_import(PG_FUNCTION_ARGS)
 
 	for (i = 0; i < n_attrs; i++)
 	{
-		values[i] = PointerGetDatum(types[i].tid != VOPS_LAST ? types[i].tid == VOPS_TEXT ? vops_alloc_text(types[i].len) : palloc0(vops_sizeof[types[i].tid]) : NULL);
+		values[i] = vops_alloc_tile(&types[i]);
 	}
 
 	in = fopen(csv_path, "r");
@@ -3310,9 +6046,13 @@ vops_import(PG_FUNCTION_ARGS)
 									break;
 								case VOPS_INT8:
 								case VOPS_TIMESTAMP:
+								case VOPS_TIMESTAMPTZ:
 								case VOPS_INTERVAL:
 									((vops_int8 *) tile)->payload[0] = ((vops_int8 *) tile)->payload[j];
 									break;
+								case VOPS_NUMERIC:
+									((vops_numeric *) tile)->payload[0] = ((vops_numeric *) tile)->payload[j];
+									break;
 								case VOPS_FLOAT4:
 									((vops_float4 *) tile)->payload[0] = ((vops_float4 *) tile)->payload[j];
 									break;
@@ -3353,6 +6093,7 @@ vops_import(PG_FUNCTION_ARGS)
 						break;
 					case VOPS_INT8:
 					case VOPS_TIMESTAMP:
+					case VOPS_TIMESTAMPTZ:
 						((vops_int8 *) tile)->payload[j] = DatumGetInt64(val);
 						break;
 					case VOPS_FLOAT4:
@@ -3394,6 +6135,13 @@ vops_import(PG_FUNCTION_ARGS)
 							}
 							break;
 						}
+					case VOPS_NUMERIC:
+						{
+							int			scale = ((vops_numeric *) tile)->scale;
+
+							((vops_numeric *) tile)->payload[j] = is_null ? 0 : vops_numeric_from_datum(val, &scale);
+							break;
+						}
 					default:
 						Assert(false);
 				}
@@ -3470,6 +6218,10 @@ vops_init_agg_state(char const *aggregates, Oid elem_type, int n_aggregates)
 	{
 		elog(ERROR, "Group by attributes should have VOPS tile type but its type is %d", elem_type);
 	}
+	if (state->agg_type == VOPS_NUMERIC)
+	{
+		elog(ERROR, "map() doesn't support vops_numeric attributes");
+	}
 	for (i = 0; i < n_aggregates; i++)
 	{
 		for (j = 0; j < VOPS_AGG_LAST && strncmp(aggregates, vops_agg_kind_map[j].name, strlen(vops_agg_kind_map[j].name)) != 0; j++);
@@ -3650,6 +6402,7 @@ vops_agg_state_accumulate(vops_agg_state *state, int64 group_by, int i, Datum *t
 			break;
 		case VOPS_INT8:
 		case VOPS_TIMESTAMP:
+		case VOPS_TIMESTAMPTZ:
 		case VOPS_INTERVAL:
 			for (j = 0; j < n_aggregates; j++)
 			{
@@ -3869,6 +6622,7 @@ vops_agg_combine(PG_FUNCTION_ARGS)
 								break;
 							case VOPS_INT8:
 							case VOPS_TIMESTAMP:
+							case VOPS_TIMESTAMPTZ:
 							case VOPS_INTERVAL:
 								if (entry0->values[i].acc.i8 < entry1->values[i].acc.i8)
 								{
@@ -3928,6 +6682,7 @@ vops_agg_combine(PG_FUNCTION_ARGS)
 								break;
 							case VOPS_INT8:
 							case VOPS_TIMESTAMP:
+							case VOPS_TIMESTAMPTZ:
 							case VOPS_INTERVAL:
 								if (entry0->values[i].acc.i8 > entry1->values[i].acc.i8)
 								{
@@ -4015,214 +6770,324 @@ vops_reduce(PG_FUNCTION_ARGS)
 															? (double) entry->values[i].acc.i8
 															: entry->values[i].acc.f8);
 						break;
-					case VOPS_AGG_AVG:
-						Assert(state->agg_type != VOPS_TEXT);
-						user_ctx->elems[i] = Float8GetDatum((is_vops_type_integer(state->agg_type)
-															 ? (double) entry->values[i].acc.i8
-															 : entry->values[i].acc.f8) / entry->values[i].count);
+					case VOPS_AGG_AVG:
+						Assert(state->agg_type != VOPS_TEXT);
+						user_ctx->elems[i] = Float8GetDatum((is_vops_type_integer(state->agg_type)
+															 ? (double) entry->values[i].acc.i8
+															 : entry->values[i].acc.f8) / entry->values[i].count);
+						break;
+					case VOPS_AGG_MAX:
+					case VOPS_AGG_MIN:
+						switch (state->agg_type)
+						{
+							case VOPS_BOOL:
+								val = (double) entry->values[i].acc.b;
+								break;
+							case VOPS_CHAR:
+								val = (double) entry->values[i].acc.ch;
+								break;
+							case VOPS_INT2:
+								val = (double) entry->values[i].acc.i2;
+								break;
+							case VOPS_INT4:
+							case VOPS_DATE:
+								val = (double) entry->values[i].acc.i4;
+								break;
+							case VOPS_INT8:
+							case VOPS_TIMESTAMP:
+							case VOPS_TIMESTAMPTZ:
+							case VOPS_INTERVAL:
+								val = (double) entry->values[i].acc.i8;
+								break;
+							case VOPS_FLOAT4:
+								val = (double) entry->values[i].acc.f4;
+								break;
+							case VOPS_FLOAT8:
+								val = entry->values[i].acc.f8;
+								break;
+							default:
+								Assert(false);
+						}
+						user_ctx->elems[i] = Float8GetDatum(val);
+						break;
+					default:
+						Assert(false);
+				}
+			}
+		}
+		values[0] = Int64GetDatum(entry->group_by);
+		values[1] = UInt64GetDatum(entry->count);
+		values[2] = PointerGetDatum(construct_md_array(user_ctx->elems, user_ctx->nulls, 1, &state->n_aggs, &lbs, FLOAT8OID, user_ctx->elmlen, user_ctx->elmbyval, user_ctx->elmalign));
+		SRF_RETURN_NEXT(func_ctx, HeapTupleGetDatum(heap_form_tuple(user_ctx->desc, values, nulls)));
+	}
+	else
+	{
+		SRF_RETURN_DONE(func_ctx);
+	}
+}
+
+/*
+ * Prepare context for unnesting tiles of the argument record
+ */
+static vops_unnest_context *
+vops_unnest_init(FunctionCallInfo fcinfo)
+{
+	int			i,
+				n_attrs;
+	Oid			argtype;
+	char		typtype;
+	HeapTupleHeader t;
+	TupleDesc	src_desc;
+	vops_rowgroup_column **dirs;
+	int		   *dir_sizes;
+	int			n_src_attrs;
+	int			k;
+	vops_unnest_context *user_ctx;
+
+	t = PG_GETARG_HEAPTUPLEHEADER(0);
+	src_desc = lookup_rowtype_tupdesc(HeapTupleHeaderGetTypeId(t), HeapTupleHeaderGetTypMod(t));
+
+	user_ctx = (vops_unnest_context *) palloc(sizeof(vops_unnest_context));
+	argtype = get_fn_expr_argtype(fcinfo->flinfo, 0);
+	typtype = get_typtype(argtype);
+	if (typtype != 'c' && typtype != 'p')
+	{
+		elog(ERROR, "Argument of unnest function should have compound type");
+	}
+	n_src_attrs = src_desc->natts;
+
+	/* Row groups are expanded to their columns */
+	n_attrs = n_src_attrs;
+	dirs = (vops_rowgroup_column **) palloc0(sizeof(vops_rowgroup_column *) * n_src_attrs);
+	dir_sizes = (int *) palloc0(sizeof(int) * n_src_attrs);
+	for (i = 0; i < n_src_attrs; i++)
+	{
+		Form_pg_attribute attr = TupleDescAttr(src_desc, i);
+
+		if (vops_is_rowgroup_type(attr->atttypid))
+		{
+			bool		is_null;
+			Datum		val = GetAttributeByNum(t, attr->attnum, &is_null);
+
+			if (is_null)
+				elog(ERROR, "Row group %s is NULL", NameStr(attr->attname));
+			dirs[i] = vops_rowgroup_directory(val, &dir_sizes[i]);
+			n_attrs += dir_sizes[i] - 1;
+		}
+	}
+
+	user_ctx->values = (Datum *) palloc(sizeof(Datum) * n_attrs);
+	user_ctx->nulls = (bool *) palloc(sizeof(bool) * n_attrs);
+	user_ctx->types = (vops_type *) palloc(sizeof(vops_type) * n_attrs);
+	user_ctx->tiles = (vops_tile_hdr **) palloc(sizeof(vops_tile_hdr *) * n_attrs);
+	user_ctx->texts = (text **) palloc0(sizeof(text *) * n_attrs);
+#if PG_VERSION_NUM>=120000
+	user_ctx->desc = CreateTemplateTupleDesc(n_attrs);
+#else
+	user_ctx->desc = CreateTemplateTupleDesc(n_attrs, false);
+#endif
+	user_ctx->n_attrs = n_attrs;
+	user_ctx->row_mask = filter_mask;
+	filter_mask = ~0;
+
+	for (i = 0, k = 0; i < n_src_attrs; i++)
+	{
+		Form_pg_attribute attr = TupleDescAttr(src_desc, i);
+		vops_type	tid = vops_get_type(attr->atttypid);
+		bool		is_null;
+		Datum		val = GetAttributeByNum(t, attr->attnum, &is_null);
+
+		if (dirs[i] != NULL)
+		{
+			int			c;
+
+			/* Extract tiles of all row group columns */
+			for (c = 0; c < dir_sizes[i]; c++, k++)
+			{
+				tid = vops_get_type(dirs[i][c].type);
+				user_ctx->types[k] = tid;
+				user_ctx->nulls[k] = false;
+				user_ctx->tiles[k] = VOPS_GET_TILE(vops_rowgroup_chunk(val, &dirs[i][c]), tid);
+				TupleDescInitEntry(user_ctx->desc, k + 1, NameStr(dirs[i][c].name), vops_map_tid[tid], -1, 0);
+			}
+			continue;
+		}
+		user_ctx->types[k] = tid;
+		user_ctx->nulls[k] = is_null;
+		if (tid == VOPS_LAST)
+		{
+			user_ctx->values[k] = val;
+			TupleDescInitEntry(user_ctx->desc, k + 1, attr->attname.data, attr->atttypid, attr->atttypmod, attr->attndims);
+		}
+		else
+		{
+			if (user_ctx->nulls[k])
+			{
+				user_ctx->tiles[k] = NULL;
+			}
+			else
+			{
+				user_ctx->tiles[k] = VOPS_GET_TILE(val, tid);
+			}
+			TupleDescInitEntry(user_ctx->desc, k + 1, attr->attname.data, vops_map_tid[tid], -1, 0);
+		}
+		k += 1;
+	}
+	for (i = 0; i < n_attrs; i++)
+	{
+		vops_tile_hdr *tile = user_ctx->tiles[i];
+
+		if (user_ctx->types[i] != VOPS_LAST && tile != NULL)
+		{
+			/* skip positions which are empty in any tile */
+			user_ctx->row_mask &= ~tile->empty_mask;
+			if (user_ctx->types[i] == VOPS_TEXT)
+			{
+				/* buffer for string elements is reused for all rows */
+				size_t		elem_size = VOPS_ELEM_SIZE((char *) tile - LONGALIGN(VARHDRSZ));
+
+				user_ctx->texts[i] = (text *) palloc(VARHDRSZ + elem_size);
+			}
+		}
+	}
+	BlessTupleDesc(user_ctx->desc);
+	ReleaseTupleDesc(src_desc);
+	return user_ctx;
+}
+
+/*
+ * Extract values of j-th elements of all tiles
+ */
+static void
+vops_unnest_fill_row(vops_unnest_context *user_ctx, int j)
+{
+	int			i;
+
+	for (i = 0; i < user_ctx->n_attrs; i++)
+	{
+		if (user_ctx->types[i] != VOPS_LAST)
+		{
+			vops_tile_hdr *tile = user_ctx->tiles[i];
+
+			if (tile == NULL || (tile->null_mask & ((uint64) 1 << j)))
+			{
+				user_ctx->nulls[i] = true;
+			}
+			else
+			{
+				Datum		value = 0;
+
+				switch (user_ctx->types[i])
+				{
+					case VOPS_BOOL:
+						value = BoolGetDatum((((vops_bool *) tile)->payload >> j) & 1);
+						break;
+					case VOPS_CHAR:
+						value = CharGetDatum(((vops_char *) tile)->payload[j]);
+						break;
+					case VOPS_INT2:
+						value = Int16GetDatum(((vops_int2 *) tile)->payload[j]);
+						break;
+					case VOPS_INT4:
+					case VOPS_DATE:
+						value = Int32GetDatum(((vops_int4 *) tile)->payload[j]);
+						break;
+					case VOPS_INT8:
+					case VOPS_TIMESTAMP:
+					case VOPS_TIMESTAMPTZ:
+					case VOPS_INTERVAL:
+						value = Int64GetDatum(((vops_int8 *) tile)->payload[j]);
+						break;
+					case VOPS_FLOAT4:
+						value = Float4GetDatum(((vops_float4 *) tile)->payload[j]);
+						break;
+					case VOPS_FLOAT8:
+						value = Float8GetDatum(((vops_float8 *) tile)->payload[j]);
 						break;
-					case VOPS_AGG_MAX:
-					case VOPS_AGG_MIN:
-						switch (state->agg_type)
+					case VOPS_TEXT:
 						{
-							case VOPS_BOOL:
-								val = (double) entry->values[i].acc.b;
-								break;
-							case VOPS_CHAR:
-								val = (double) entry->values[i].acc.ch;
-								break;
-							case VOPS_INT2:
-								val = (double) entry->values[i].acc.i2;
-								break;
-							case VOPS_INT4:
-							case VOPS_DATE:
-								val = (double) entry->values[i].acc.i4;
-								break;
-							case VOPS_INT8:
-							case VOPS_TIMESTAMP:
-							case VOPS_INTERVAL:
-								val = (double) entry->values[i].acc.i8;
-								break;
-							case VOPS_FLOAT4:
-								val = (double) entry->values[i].acc.f4;
-								break;
-							case VOPS_FLOAT8:
-								val = entry->values[i].acc.f8;
-								break;
-							default:
-								Assert(false);
+							size_t		elem_size = VOPS_ELEM_SIZE((char *) tile - LONGALIGN(VARHDRSZ));
+							char	   *src = (char *) (tile + 1) + elem_size * j;
+							size_t		len = strnlen(src, elem_size);
+							text	   *t = user_ctx->texts[i];
+
+							SET_VARSIZE(t, VARHDRSZ + len);
+							memcpy(VARDATA(t), src, len);
+							value = PointerGetDatum(t);
+							break;
 						}
-						user_ctx->elems[i] = Float8GetDatum(val);
+					case VOPS_NUMERIC:
+						value = vops_numeric_get_datum(((vops_numeric *) tile)->payload[j], ((vops_numeric *) tile)->scale);
 						break;
 					default:
 						Assert(false);
 				}
+				user_ctx->values[i] = value;
+				user_ctx->nulls[i] = false;
 			}
 		}
-		values[0] = Int64GetDatum(entry->group_by);
-		values[1] = UInt64GetDatum(entry->count);
-		values[2] = PointerGetDatum(construct_md_array(user_ctx->elems, user_ctx->nulls, 1, &state->n_aggs, &lbs, FLOAT8OID, user_ctx->elmlen, user_ctx->elmbyval, user_ctx->elmalign));
-		SRF_RETURN_NEXT(func_ctx, HeapTupleGetDatum(heap_form_tuple(user_ctx->desc, values, nulls)));
-	}
-	else
-	{
-		SRF_RETURN_DONE(func_ctx);
 	}
 }
 
+/*
+ * Unnest tiles into set of rows. If caller accepts materialize mode, then
+ * all rows of the tile are placed in tuplestore in one call, otherwise
+ * rows are returned one by one. Non-empty positions are enumerated by
+ * scanning bits of the mask.
+ */
 PG_FUNCTION_INFO_V1(vops_unnest);
 Datum
 vops_unnest(PG_FUNCTION_ARGS)
 {
-	int			i,
-				j,
-				n_attrs;
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
 	FuncCallContext *func_ctx;
 	vops_unnest_context *user_ctx;
+	uint64		mask;
+	int			j;
 
-	if (SRF_IS_FIRSTCALL())
+	if (rsinfo != NULL && IsA(rsinfo, ReturnSetInfo) && (rsinfo->allowedModes & SFRM_Materialize))
 	{
-		Oid			argtype;
+		Tuplestorestate *tupstore;
+		TupleDesc	desc;
 		MemoryContext old_context;
-		char		typtype;
-		HeapTupleHeader t;
-		TupleDesc	src_desc;
 
-		func_ctx = SRF_FIRSTCALL_INIT();
-		old_context = MemoryContextSwitchTo(func_ctx->multi_call_memory_ctx);
+		user_ctx = vops_unnest_init(fcinfo);
 
-		t = PG_GETARG_HEAPTUPLEHEADER(0);
-		src_desc = lookup_rowtype_tupdesc(HeapTupleHeaderGetTypeId(t), HeapTupleHeaderGetTypMod(t));
+		old_context = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+		tupstore = tuplestore_begin_heap((rsinfo->allowedModes & SFRM_Materialize_Random) != 0, false, work_mem);
+		desc = CreateTupleDescCopy(user_ctx->desc);
+		MemoryContextSwitchTo(old_context);
 
-		user_ctx = (vops_unnest_context *) palloc(sizeof(vops_unnest_context));
-		argtype = get_fn_expr_argtype(fcinfo->flinfo, 0);
-		typtype = get_typtype(argtype);
-		if (typtype != 'c' && typtype != 'p')
+		for (mask = user_ctx->row_mask; mask != 0; mask &= mask - 1)
 		{
-			elog(ERROR, "Argument of unnest function should have compound type");
+			vops_unnest_fill_row(user_ctx, VOPS_CTZ(mask));
+			tuplestore_putvalues(tupstore, desc, user_ctx->values, user_ctx->nulls);
 		}
-		n_attrs = src_desc->natts;
-
-		user_ctx->values = (Datum *) palloc(sizeof(Datum) * n_attrs);
-		user_ctx->nulls = (bool *) palloc(sizeof(bool) * n_attrs);
-		user_ctx->types = (vops_type *) palloc(sizeof(vops_type) * n_attrs);
-		user_ctx->tiles = (vops_tile_hdr **) palloc(sizeof(vops_tile_hdr *) * n_attrs);
-#if PG_VERSION_NUM>=120000
-		user_ctx->desc = CreateTemplateTupleDesc(n_attrs);
-#else
-		user_ctx->desc = CreateTemplateTupleDesc(n_attrs, false);
-#endif
-		func_ctx->user_fctx = user_ctx;
-		user_ctx->n_attrs = n_attrs;
-		user_ctx->tile_pos = 0;
-		user_ctx->filter_mask = filter_mask;
-		filter_mask = ~0;
+		rsinfo->returnMode = SFRM_Materialize;
+		rsinfo->setResult = tupstore;
+		rsinfo->setDesc = desc;
+		return (Datum) 0;
+	}
 
-		for (i = 0; i < n_attrs; i++)
-		{
-			Form_pg_attribute attr = TupleDescAttr(src_desc, i);
-			vops_type	tid = vops_get_type(attr->atttypid);
-			Datum		val = GetAttributeByNum(t, attr->attnum, &user_ctx->nulls[i]);
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext old_context;
 
-			user_ctx->types[i] = tid;
-			if (tid == VOPS_LAST)
-			{
-				user_ctx->values[i] = val;
-				TupleDescInitEntry(user_ctx->desc, attr->attnum, attr->attname.data, attr->atttypid, attr->atttypmod, attr->attndims);
-			}
-			else
-			{
-				if (user_ctx->nulls[i])
-				{
-					user_ctx->tiles[i] = NULL;
-				}
-				else
-				{
-					user_ctx->tiles[i] = VOPS_GET_TILE(val, tid);
-				}
-				TupleDescInitEntry(user_ctx->desc, attr->attnum, attr->attname.data, vops_map_tid[tid], -1, 0);
-			}
-		}
-		TupleDescGetAttInMetadata(user_ctx->desc);
-		ReleaseTupleDesc(src_desc);
+		func_ctx = SRF_FIRSTCALL_INIT();
+		old_context = MemoryContextSwitchTo(func_ctx->multi_call_memory_ctx);
+		func_ctx->user_fctx = vops_unnest_init(fcinfo);
 		MemoryContextSwitchTo(old_context);
 	}
 	func_ctx = SRF_PERCALL_SETUP();
 	user_ctx = (vops_unnest_context *) func_ctx->user_fctx;
-	n_attrs = user_ctx->n_attrs;
 
-	for (j = user_ctx->tile_pos; j < TILE_SIZE; j++)
+	mask = user_ctx->row_mask;
+	if (mask != 0)
 	{
-		if (user_ctx->filter_mask & ((uint64) 1 << j))
-		{
-			for (i = 0; i < n_attrs; i++)
-			{
-				if (user_ctx->types[i] != VOPS_LAST)
-				{
-					vops_tile_hdr *tile = user_ctx->tiles[i];
-
-					if (tile != NULL && (tile->empty_mask & ((uint64) 1 << j)))
-					{
-						goto NextTuple;
-					}
-					if (tile == NULL || (tile->null_mask & ((uint64) 1 << j)))
-					{
-						user_ctx->nulls[i] = true;
-					}
-					else
-					{
-						Datum		value = 0;
-
-						switch (user_ctx->types[i])
-						{
-							case VOPS_BOOL:
-								value = BoolGetDatum((((vops_bool *) tile)->payload >> j) & 1);
-								break;
-							case VOPS_CHAR:
-								value = CharGetDatum(((vops_char *) tile)->payload[j]);
-								break;
-							case VOPS_INT2:
-								value = Int16GetDatum(((vops_int2 *) tile)->payload[j]);
-								break;
-							case VOPS_INT4:
-							case VOPS_DATE:
-								value = Int32GetDatum(((vops_int4 *) tile)->payload[j]);
-								break;
-							case VOPS_INT8:
-							case VOPS_TIMESTAMP:
-							case VOPS_INTERVAL:
-								value = Int64GetDatum(((vops_int8 *) tile)->payload[j]);
-								break;
-							case VOPS_FLOAT4:
-								value = Float4GetDatum(((vops_float4 *) tile)->payload[j]);
-								break;
-							case VOPS_FLOAT8:
-								value = Float8GetDatum(((vops_float8 *) tile)->payload[j]);
-								break;
-							case VOPS_TEXT:
-								{
-									size_t		elem_size = VOPS_ELEM_SIZE((char *) tile - LONGALIGN(VARHDRSZ));
-									char	   *src = (char *) (tile + 1) + elem_size * j;
-									size_t		len = strnlen(src, elem_size);
-									text	   *t = (text *) palloc(VARHDRSZ + len);
-
-									SET_VARSIZE(t, VARHDRSZ + len);
-									memcpy(VARDATA(t), src, len);
-									value = PointerGetDatum(t);
-									break;
-								}
-							default:
-								Assert(false);
-						}
-						user_ctx->values[i] = value;
-						user_ctx->nulls[i] = false;
-					}
-				}
-			}
-			user_ctx->tile_pos = j + 1;
-			SRF_RETURN_NEXT(func_ctx, HeapTupleGetDatum(heap_form_tuple(user_ctx->desc, user_ctx->values, user_ctx->nulls)));
-		}
-NextTuple:;
+		j = VOPS_CTZ(mask);
+		user_ctx->row_mask = mask & (mask - 1);
+		vops_unnest_fill_row(user_ctx, j);
+		SRF_RETURN_NEXT(func_ctx, HeapTupleGetDatum(heap_form_tuple(user_ctx->desc, user_ctx->values, user_ctx->nulls)));
 	}
 	SRF_RETURN_DONE(func_ctx);
 }
@@ -4433,6 +7298,147 @@ is_select_from_vops_projection(Query *query, vops_var *var)
 	expression_tree_mutator((node), (mutator), (context))
 #endif
 
+/*
+ * Check if expression is scalar value casted to VOPS tile, i.e. 0::vops_int4
+ */
+static Node *
+vops_get_cast_scalar(Node *node)
+{
+	if (IsA(node, FuncExpr))
+	{
+		FuncExpr   *cast = (FuncExpr *) node;
+
+		if ((cast->funcformat == COERCE_EXPLICIT_CAST || cast->funcformat == COERCE_IMPLICIT_CAST)
+			&& list_length(cast->args) == 1
+			&& is_vops_type(cast->funcresulttype)
+			&& !is_vops_type(exprType(linitial(cast->args))))
+		{
+			return (Node *) linitial(cast->args);
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Construct vops_if(cond, then, else) call, using variant with scalar argument if possible.
+ * If else_expr is NULL, then elements for which condition is false are null.
+ */
+static Node *
+vops_make_if(Node *cond, Node *then_expr, Node *else_expr, Oid type)
+{
+	List	   *name = list_make1(makeString("vops_if"));
+	Oid			argtypes[3];
+	Oid			func;
+	Node	   *scalar;
+
+	argtypes[0] = vops_bool_oid;
+	argtypes[1] = type;
+	if (else_expr == NULL)
+	{
+		func = LookupFuncName(name, 2, argtypes, true);
+		return func == InvalidOid ? NULL
+			: (Node *) makeFuncExpr(func, type, list_make2(cond, then_expr),
+									InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+	}
+	argtypes[2] = type;
+	if ((scalar = vops_get_cast_scalar(else_expr)) != NULL)
+	{
+		argtypes[2] = exprType(scalar);
+		func = LookupFuncName(name, 3, argtypes, true);
+		if (func != InvalidOid)
+			return (Node *) makeFuncExpr(func, type, list_make3(cond, then_expr, scalar),
+										 InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+		argtypes[2] = type;
+	}
+	if ((scalar = vops_get_cast_scalar(then_expr)) != NULL)
+	{
+		argtypes[1] = exprType(scalar);
+		func = LookupFuncName(name, 3, argtypes, true);
+		if (func != InvalidOid)
+			return (Node *) makeFuncExpr(func, type, list_make3(cond, scalar, else_expr),
+										 InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+		argtypes[1] = type;
+	}
+	func = LookupFuncName(name, 3, argtypes, true);
+	return func == InvalidOid ? NULL
+		: (Node *) makeFuncExpr(func, type, list_make3(cond, then_expr, else_expr),
+								InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+}
+
+/*
+ * Transform (CASE WHEN filter(c1) THEN e1 WHEN filter(c2) THEN e2 ELSE e3 END)
+ * to vops_if(c1, e1, vops_if(c2, e2, e3)).
+ * Returns NULL if expression can not be transformed.
+ */
+static Node *
+vops_transform_case(CaseExpr *expr)
+{
+	Node	   *result = (Node *) expr->defresult;
+	int			i;
+
+	if (result != NULL && IsA(result, Const) && ((Const *) result)->constisnull)
+		result = NULL;			/* no ELSE branch */
+
+	for (i = list_length(expr->args) - 1; i >= 0; i--)
+	{
+		CaseWhen   *when = list_nth_node(CaseWhen, expr->args, i);
+		FuncExpr   *filter = (FuncExpr *) when->expr;
+
+		if (!IsA(filter, FuncExpr) || filter->funcid != filter_oid)
+			return NULL;		/* condition is not vector */
+
+		result = vops_make_if(linitial(filter->args), (Node *) when->result, result, expr->casetype);
+		if (result == NULL)
+			return NULL;
+	}
+	return result;
+}
+
+/*
+ * Transform GREATEST(e1, e2, e3) to vops_greatest(vops_greatest(e1, e2), e3)
+ * (and the same for LEAST). Scalar values casted to tile are passed as is.
+ * Returns NULL if expression can not be transformed.
+ */
+static Node *
+vops_transform_minmax(MinMaxExpr *expr)
+{
+	List	   *name = list_make1(makeString(expr->op == IS_GREATEST ? "vops_greatest" : "vops_least"));
+	Node	   *result = NULL;
+	ListCell   *cell;
+
+	foreach(cell, expr->args)
+	{
+		Node	   *arg = (Node *) lfirst(cell);
+		Node	   *scalar;
+		Oid			argtypes[2];
+		Oid			func = InvalidOid;
+
+		if (result == NULL)
+		{
+			result = arg;
+			continue;
+		}
+		argtypes[0] = expr->minmaxtype;
+		if ((scalar = vops_get_cast_scalar(arg)) != NULL)
+		{
+			argtypes[1] = exprType(scalar);
+			func = LookupFuncName(name, 2, argtypes, true);
+			if (func != InvalidOid)
+				arg = scalar;
+		}
+		if (func == InvalidOid)
+		{
+			argtypes[1] = expr->minmaxtype;
+			func = LookupFuncName(name, 2, argtypes, true);
+			if (func == InvalidOid)
+				return NULL;
+		}
+		result = (Node *) makeFuncExpr(func, expr->minmaxtype, list_make2(result, arg),
+									   InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
+	}
+	return result;
+}
+
 static Node *
 vops_expression_tree_mutator(Node *node, void *context)
 {
@@ -4571,6 +7577,30 @@ vops_expression_tree_mutator(Node *node, void *context)
 										 InvalidOid, InvalidOid, COERCE_EXPLICIT_CALL);
 		}
 	}
+	else if (IsA(node, CaseExpr))
+	{
+		CaseExpr   *expr = (CaseExpr *) node;
+
+		if (expr->arg == NULL && is_vops_type(expr->casetype))
+		{
+			Node	   *result = vops_transform_case(expr);
+
+			if (result != NULL)
+				return result;
+		}
+	}
+	else if (IsA(node, MinMaxExpr))
+	{
+		MinMaxExpr *expr = (MinMaxExpr *) node;
+
+		if (is_vops_type(expr->minmaxtype))
+		{
+			Node	   *result = vops_transform_minmax(expr);
+
+			if (result != NULL)
+				return result;
+		}
+	}
 	return node;
 }
 
@@ -4585,7 +7615,8 @@ typedef enum
 	SCOPE_DEFAULT = 0,
 	SCOPE_WHERE = 1,			/* WHERE clause */
 	SCOPE_AGGREGATE = 2,		/* argument of aggregate */
-	SCOPE_TARGET_LIST = 4		/* target list */
+	SCOPE_TARGET_LIST = 4,		/* target list */
+	SCOPE_SEMIJOIN = 8			/* left operand of IN subquery */
 } vops_clause_scope;
 
 /* Usage of table's attributes */
@@ -4611,6 +7642,10 @@ typedef struct
 								 * pseudorelations) */
 	Const	  **consts;			/* array references to Const nodes in query,
 								 * indexed by literal location */
+	int		   *semijoins;		/* columns used as left operand of IN
+								 * subquery (attno*n_rels + relno), indexed
+								 * by column reference location */
+	List	   *conjuncts;		/* top-level conjuncts of WHERE clause */
 	Bitmapset  *operands;		/* columns used in one expression */
 	vops_table_refs *refs;		/* usage of table' variables (index by
 								 * relation number - 1) */
@@ -4673,6 +7708,25 @@ vops_check_clusters(vops_vars_cluster *clusters, Bitmapset *vectorCols, Bitmapse
 	return true;
 }
 
+/*
+ * Flatten AND tree of WHERE clause
+ */
+static List *
+vops_get_conjuncts(Node *node, List *conjuncts)
+{
+	if (node != NULL && IsA(node, BoolExpr) && ((BoolExpr *) node)->boolop == AND_EXPR)
+	{
+		ListCell   *cell;
+
+		foreach(cell, ((BoolExpr *) node)->args)
+		{
+			conjuncts = vops_get_conjuncts(lfirst(cell), conjuncts);
+		}
+		return conjuncts;
+	}
+	return lappend(conjuncts, node);
+}
+
 /*
  * Collect information about attribute usage in the query
  */
@@ -4689,6 +7743,7 @@ vops_pullvars_walker(Node *node, vops_pullvar_context *ctx)
 		Var		   *var = (Var *) node;
 		int			relid = var->varno;
 		int			attno = var->varattno;
+		int			location = var->location;
 
 		if (!IS_SPECIAL_VARNO(relid) && attno >= 0)
 		{
@@ -4720,6 +7775,8 @@ vops_pullvars_walker(Node *node, vops_pullvar_context *ctx)
 				{
 					ctx->operands = bms_add_member(ctx->operands, attno * ctx->n_rels + relid - 1);
 					rel->where = bms_add_member(rel->where, attno);
+					if ((scope & SCOPE_SEMIJOIN) && location >= 0)
+						ctx->semijoins[location] = attno * ctx->n_rels + relid;
 				}
 				else
 				{
@@ -4754,6 +7811,30 @@ vops_pullvars_walker(Node *node, vops_pullvar_context *ctx)
 		ctx->operands = save_operands;
 		return false;
 	}
+	else if (IsA(node, SubLink))
+	{
+		SubLink    *sublink = (SubLink *) node;
+
+		/*
+		 * Subquery has its own range table, so do not descend into it.
+		 * Column compared with result of uncorrelated IN subquery in
+		 * top-level conjunct of WHERE clause can be vector: such predicate is
+		 * replaced with vops_in() by vops_rewrite_semijoins.
+		 */
+		if (sublink->subLinkType == ANY_SUBLINK
+			&& sublink->testexpr != NULL
+			&& IsA(sublink->testexpr, OpExpr)
+			&& IsA(linitial(((OpExpr *) sublink->testexpr)->args), Var)
+			&& strcmp(get_opname(((OpExpr *) sublink->testexpr)->opno), "=") == 0
+			&& list_member_ptr(ctx->conjuncts, sublink)
+			&& !contain_vars_of_level(sublink->subselect, 1))
+		{
+			ctx->scope |= SCOPE_SEMIJOIN;
+		}
+		(void) vops_pullvars_walker(sublink->testexpr, ctx);
+		ctx->scope = scope;
+		return false;
+	}
 	else if (IsA(node, Aggref))
 	{
 		ctx->scope |= SCOPE_AGGREGATE;
@@ -4769,6 +7850,7 @@ vops_pullvars_walker(Node *node, vops_pullvar_context *ctx)
 
 		ctx->operands = NULL;
 		ctx->scope |= SCOPE_WHERE;
+		ctx->conjuncts = vops_get_conjuncts(from->quals, NIL);
 		(void) expression_tree_walker(from->quals, vops_pullvars_walker, ctx);
 		vops_update_vars_clusters(ctx);
 		ctx->operands = save_operands;
@@ -4937,6 +8019,54 @@ vops_add_literal_type_casts(Node *node, Const **consts)
 	return node;
 }
 
+/*
+ * Replace "col IN (subquery)" with "vops_in(col, array(subquery))" if col is vector column:
+ * result of subquery is loaded in hash set once and whole tiles are checked against it.
+ * Only uncorrelated subqueries in top-level conjuncts are marked by vops_pullvars_walker.
+ */
+static Node *
+vops_rewrite_semijoins(Node *node, int *semijoins, Bitmapset *vectorCols)
+{
+	if (node == NULL)
+		return NULL;
+
+	if (IsA(node, BoolExpr) && ((BoolExpr *) node)->boolop == AND_EXPR)
+	{
+		ListCell   *cell;
+
+		foreach(cell, ((BoolExpr *) node)->args)
+		{
+			lfirst(cell) = vops_rewrite_semijoins(lfirst(cell), semijoins, vectorCols);
+		}
+	}
+	else if (IsA(node, SubLink))
+	{
+		SubLink    *sublink = (SubLink *) node;
+
+		if (sublink->subLinkType == ANY_SUBLINK
+			&& sublink->testexpr != NULL
+			&& IsA(sublink->testexpr, ColumnRef)
+			&& list_length(sublink->operName) == 1
+			&& strcmp(strVal(linitial(sublink->operName)), "=") == 0)
+		{
+			int			location = ((ColumnRef *) sublink->testexpr)->location;
+
+			if (location >= 0 && semijoins[location] != 0
+				&& bms_is_member(semijoins[location] - 1, vectorCols))
+			{
+				SubLink    *array = makeNode(SubLink);
+
+				array->subLinkType = ARRAY_SUBLINK;
+				array->subselect = sublink->subselect;
+				array->location = sublink->location;
+				node = (Node *) makeFuncCall(list_make1(makeString("vops_in")),
+											 list_make2(sublink->testexpr, array), FUNC_CALL_CTX);
+			}
+		}
+	}
+	return node;
+}
+
 static RangeVar *
 vops_get_join_rangevar(Node *node, int *relno)
 {
@@ -4977,6 +8107,49 @@ vops_get_rangevar(List *from, int relno)
 	return NULL;
 }
 
+/* Types of external parameters ($n) used in the query */
+typedef struct
+{
+	Oid		   *types;
+	int			n_params;
+} vops_param_types;
+
+/*
+ * Collect types of parameters of original query: them are passed to analyzer of the query
+ * with substituted projections, so prepared statements can also use projections.
+ */
+static bool
+vops_param_types_walker(Node *node, vops_param_types *ctx)
+{
+	if (node == NULL)
+		return false;
+
+	if (IsA(node, Param))
+	{
+		Param	   *param = (Param *) node;
+
+		if (param->paramkind == PARAM_EXTERN && param->paramid > 0)
+		{
+			if (param->paramid > ctx->n_params)
+			{
+				Oid		   *types = (Oid *) palloc0(param->paramid * sizeof(Oid));
+
+				if (ctx->n_params != 0)
+					memcpy(types, ctx->types, ctx->n_params * sizeof(Oid));
+				ctx->types = types;
+				ctx->n_params = param->paramid;
+			}
+			ctx->types[param->paramid - 1] = param->paramtype;
+		}
+		return false;
+	}
+	else if (IsA(node, Query))
+	{
+		return query_tree_walker((Query *) node, vops_param_types_walker, ctx, 0);
+	}
+	return expression_tree_walker(node, vops_param_types_walker, ctx);
+}
+
 /*
  * Try to substitute tables with their VOPS projections.
  * Criterias for such substitution:
@@ -4989,6 +8162,7 @@ static void
 vops_substitute_tables_with_projections(char const *queryString, Query *query)
 {
 	vops_pullvar_context pullvar_ctx;
+	vops_param_types param_types;
 	int			i,
 				j,
 				relno,
@@ -5010,10 +8184,16 @@ vops_substitute_tables_with_projections(char const *queryString, Query *query)
 	Node	   *parsetree = NULL;
 #endif
 
+	param_types.types = NULL;
+	param_types.n_params = 0;
+	query_tree_walker(query, vops_param_types_walker, &param_types, 0);
+
 	pullvar_ctx.query = query;
 	pullvar_ctx.n_rels = n_rels;
 	pullvar_ctx.clusters = NULL;
 	pullvar_ctx.consts = (Const **) palloc0((strlen(queryString) + 1) * sizeof(Const *));
+	pullvar_ctx.semijoins = (int *) palloc0((strlen(queryString) + 1) * sizeof(int));
+	pullvar_ctx.conjuncts = NIL;
 	pullvar_ctx.scope = SCOPE_DEFAULT;
 	pullvar_ctx.refs = palloc0(n_rels * sizeof(vops_table_refs));
 	query_tree_walker(query, vops_pullvars_walker, &pullvar_ctx, QTW_IGNORE_CTE_SUBQUERIES | QTW_IGNORE_RANGE_TABLE);
@@ -5211,13 +8391,14 @@ vops_substitute_tables_with_projections(char const *queryString, Query *query)
 																				 * in one expression */
 	{
 		vops_add_literal_type_casts(select->whereClause, pullvar_ctx.consts);
+		select->whereClause = vops_rewrite_semijoins(select->whereClause, pullvar_ctx.semijoins, vectorCols);
 
 		PG_TRY();
 		{
 #if PG_VERSION_NUM>=150000
 #define parse_analyze parse_analyze_fixedparams
 #endif
-			Query	   *subst = parse_analyze(parsetree, queryString, NULL, 0
+			Query	   *subst = parse_analyze(parsetree, queryString, param_types.types, param_types.n_params
 #if PG_VERSION_NUM>=100000
 											  ,NULL
 #endif
@@ -5269,8 +8450,12 @@ vops_resolve_functions(void)
 
 			for (i = VOPS_CHAR; i < VOPS_LAST; i++)
 			{
-				profile[0] = profile[1] = vops_type_map[i].oid;
-				coalesce_oids[i] = LookupFuncName(list_make1(makeString("ifnull")), 2, profile, false);
+				/* types added in later versions are absent until extension is updated */
+				if (vops_type_map[i].oid != InvalidOid)
+				{
+					profile[0] = profile[1] = vops_type_map[i].oid;
+					coalesce_oids[i] = LookupFuncName(list_make1(makeString("ifnull")), 2, profile, true);
+				}
 			}
 		}
 	}
@@ -5300,8 +8485,8 @@ vops_post_parse_analysis_hook(ParseState *pstate, Query *query)
 	filter_mask = ~0;
 	if (query->commandType == CMD_SELECT &&
 		vops_auto_substitute_projections &&
-		pstate->p_paramref_hook == NULL)	/* do not support prepared
-											 * statements yet */
+		pstate->p_pre_columnref_hook == NULL &&	/* PL/pgSQL and SQL function variables can not */
+		pstate->p_post_columnref_hook == NULL)	/* be resolved when substituted query is analyzed */
 	{
 		vops_substitute_tables_with_projections(pstate->p_sourcetext, query);
 	}
@@ -5353,7 +8538,7 @@ vops_explain_hook(Query *query,
 
 	if (query->commandType == CMD_SELECT &&
 		vops_auto_substitute_projections &&
-		params == NULL)			/* do not support prepared statements yet */
+		(params == NULL || params->parserSetup == NULL))	/* parameters are not PL/pgSQL variables */
 	{
 		char	   *explain = pstrdup(queryString);
 		char	   *select;
@@ -5400,6 +8585,7 @@ static void
 reset_static_cache(void)
 {
 	vops_type_map[0].oid = InvalidOid;
+	vops_rowgroup_oid = InvalidOid;
 	is_not_null_oid = InvalidOid;
 }
 
@@ -5423,4 +8609,7 @@ _PG_init(void)
 							 NULL,
 							 NULL,
 							 NULL);
+	vops_tile_cache_init();
+	vops_fdw_init();
+	vops_scan_init();
 }
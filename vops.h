@@ -6,6 +6,21 @@
 #define VOPS_TEXT_TILE(val)     ((vops_tile_hdr*)((char*) pg_detoast_datum(val) + LONGALIGN(VARHDRSZ)))
 #define VOPS_GET_TILE(val,tid)  (((tid) == VOPS_TEXT) ? VOPS_TEXT_TILE((struct varlena *) DatumGetPointer(val)) : (vops_tile_hdr*)DatumGetPointer(val))
 
+/* Position of the lowest bit set in the non-zero mask */
+#if PG_VERSION_NUM>=120000
+#include "port/pg_bitutils.h"
+#define VOPS_CTZ(mask)          pg_rightmost_one_pos64(mask)
+#else
+#define VOPS_CTZ(mask)          __builtin_ctzll(mask)
+#endif
+
+/* Position of the highest bit set in the non-zero mask */
+#if PG_VERSION_NUM>=120000
+#define VOPS_MSB(mask)          pg_leftmost_one_pos64(mask)
+#else
+#define VOPS_MSB(mask)          (63 - __builtin_clzll(mask))
+#endif
+
 typedef enum
 {
 	VOPS_BOOL,
@@ -15,10 +30,12 @@ typedef enum
 	VOPS_INT8,
 	VOPS_DATE,
 	VOPS_TIMESTAMP,
+	VOPS_TIMESTAMPTZ,
 	VOPS_FLOAT4,
 	VOPS_FLOAT8,
 	VOPS_INTERVAL,
 	VOPS_TEXT,
+	VOPS_NUMERIC,
 	VOPS_LAST,
 } vops_type;
 
@@ -73,6 +90,15 @@ typedef struct
 	uint64		payload;
 } vops_bool;
 
+/* Decimal values multiplied by 10^scale */
+typedef struct
+{
+	vops_tile_hdr hdr;
+	int64		payload[TILE_SIZE];
+	int32		scale;
+	int32		padding;
+} vops_numeric;
+
 typedef struct
 {
 	uint64		count;
@@ -138,9 +164,9 @@ typedef struct
 	vops_type  *types;
 	TupleDesc	desc;
 	int			n_attrs;
-	int			tile_pos;
-	uint64		filter_mask;
+	uint64		row_mask;		/* positions which are not yet returned */
 	vops_tile_hdr **tiles;
+	text	  **texts;			/* buffers for elements of text tiles */
 } vops_unnest_context;
 
 typedef struct
@@ -172,7 +198,60 @@ typedef struct
 	bool		ts_is_null;
 } vops_first_state;
 
+/* Directory entry of row group: describes one column chunk */
+typedef struct
+{
+	NameData	name;			/* name of the column */
+	Oid			type;			/* OID of tile type */
+	int32		typmod;			/* element width for vops_text, -1 for other types */
+	uint32		offset;			/* offset of chunk from the beginning of row group */
+	uint32		size;			/* size of chunk */
+	uint32		n_values;		/* number of non-null elements in the chunk */
+	vops_value	low;			/* minimal value (i8 for integer types, f8 for floating point types) */
+	vops_value	high;			/* maximal value */
+} vops_rowgroup_column;
+
+/*
+ * PAX-style row group: tiles of several columns packed in one varlena.
+ * Directory is followed by MAXALIGNed column chunks, so any column can be
+ * extracted with a single slice fetch without touching other chunks.
+ * Directory also keeps min/max of each chunk (except boolean, interval and text),
+ * so row groups can be skipped without fetching their chunks.
+ */
+typedef struct
+{
+	int32		vl_len_;
+	int32		n_columns;
+	vops_rowgroup_column columns[FLEXIBLE_ARRAY_MEMBER];
+} vops_rowgroup;
+
+#define VOPS_ROWGROUP_HDRSZ            offsetof(vops_rowgroup, columns)
+#define VOPS_ROWGROUP_PREFETCH_COLUMNS 16 /* directory entries fetched together with row group header */
+
 extern vops_type vops_get_type(Oid typid);
+extern Oid	vops_get_tile_type(Oid scalar_type);
+extern Oid	vops_get_elem_type(vops_type tid);
+extern bool vops_is_rowgroup_type(Oid typid);
+extern vops_rowgroup_column *vops_rowgroup_directory(Datum rowgroup, int *n_columns);
+extern Datum vops_rowgroup_chunk(Datum rowgroup, vops_rowgroup_column const *column);
+extern Datum vops_numeric_get_datum(int64 val, int scale);
+extern struct varlena *vops_detoast_tile(Datum datum);
+extern void vops_tile_cache_init(void);
+extern void vops_fdw_init(void);
+extern void vops_scan_init(void);
+
+/* Conditions pushed down to VOPS foreign table compiled into vector predicate */
+struct vops_scan_pred;
+struct List;
+extern struct vops_scan_pred *vops_scan_compile_quals(struct List *quals, Index relid);
+extern bool vops_scan_check_quals(struct vops_scan_pred *pred, int const *attnos, vops_type const *types);
+extern uint64 vops_scan_eval_quals(struct vops_scan_pred *pred, Datum *values, bool *nulls, int const *attnos);
+
+/* Cost of applying vector operator to one tile */
+extern double vops_tile_operator_cost;
+
+/* Get detoasted vops_text tile, using shared tile cache */
+#define PG_GETARG_VOPS_TEXT(n)  vops_detoast_tile(PG_GETARG_DATUM(n))
 
 #if PG_VERSION_NUM>=130000
 #define heap_open(oid, lock) table_open(oid, lock)
@@ -0,0 +1,514 @@
+/*
+ * vops_cache.c
+ *
+ * Shared cache of detoasted tiles.
+ *
+ * Wide vops_text tiles are usually moved to TOAST and compressed, so each access
+ * to them requires fetching and decompressing TOAST chunks. Detoasted tiles are
+ * kept in shared memory and reused by all backends.
+ * Datum passed to the function knows nothing about the tuple it belongs to, so
+ * cache is keyed by TOAST pointer (OID of TOAST relation and value identifier).
+ * Value identifier can be reused after the old value is removed, so each slot
+ * remembers generation of its TOAST relation, which is advanced by relcache
+ * invalidation of this relation (TRUNCATE, VACUUM, DROP,...), and slots of
+ * older generation are ignored. Tiles compressed inline are keyed by hash of
+ * compressed datum, which is kept in the slot to check the match.
+ * Fixed size slots are replaced using clock-sweep algorithm.
+ *
+ * Also each backend remembers tiles detoasted in the current memory context,
+ * so the same tile referenced by several operators of the expression is
+ * detoasted only once per row.
+ */
+#include "postgres.h"
+
+#include "funcapi.h"
+#include "miscadmin.h"
+
+#include "access/htup_details.h"
+#if PG_VERSION_NUM>=130000
+#include "access/detoast.h"
+#else
+#include "access/tuptoaster.h"
+#endif
+#if PG_VERSION_NUM>=130000
+#include "common/hashfn.h"
+#else
+#include "access/hash.h"
+#endif
+#include "port/atomics.h"
+#include "storage/ipc.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/hsearch.h"
+#include "utils/inval.h"
+#include "utils/memutils.h"
+#include "vops.h"
+
+#define VOPS_TILE_CACHE_SLOT_SIZE (8*1024)	/* larger tiles are not cached */
+#define VOPS_TILE_CACHE_MAX_USAGE 5
+#define VOPS_TILE_CACHE_GENERATIONS 1024	/* number of relation generation counters */
+#define VOPS_DETOAST_CACHE_SIZE   8	/* number of tiles cached by backend */
+
+/*
+ * Tile stored in TOAST is identified by database, TOAST relation and value identifier.
+ * For tile compressed inline both OIDs are InvalidOid and valueid is hash of compressed datum.
+ */
+typedef struct
+{
+	Oid			dbid;			/* TOAST relation OIDs are unique only within database */
+	Oid			toastrelid;
+	Oid			valueid;
+} vops_tile_cache_key;
+
+typedef struct
+{
+	vops_tile_cache_key key;
+	int			slot;
+} vops_tile_cache_entry;
+
+typedef struct
+{
+	vops_tile_cache_key key;
+	uint32		size;			/* size of detoasted tile, 0 for free slot */
+	uint32		image_size;		/* size of compressed datum stored after the tile, 0 for TOAST */
+	uint32		generation;		/* generation of TOAST relation when tile was loaded */
+	pg_atomic_uint32 usage_count;
+} vops_tile_cache_slot;
+
+typedef struct
+{
+	LWLock	   *lock;
+	int			n_slots;
+	int			clock_hand;
+	pg_atomic_uint64 hits;
+	pg_atomic_uint64 misses;
+	pg_atomic_uint32 generations[VOPS_TILE_CACHE_GENERATIONS];	/* indexed by hash of TOAST relation */
+	vops_tile_cache_slot slots[FLEXIBLE_ARRAY_MEMBER];
+} vops_tile_cache_hdr;
+
+static int	vops_tile_cache_size;	/* kB */
+static vops_tile_cache_hdr *vops_tile_cache;
+static HTAB *vops_tile_cache_hash;
+static char *vops_tile_cache_data;
+
+/*
+ * Backend local cache of detoasted tiles. Detoasted tiles are allocated in the memory context
+ * of the caller (per-tuple context of the expression), and cache is cleared when this context is reset.
+ */
+typedef struct
+{
+	struct varlena *toasted;	/* copy of TOAST pointer or compressed datum */
+	struct varlena *detoasted;
+} vops_detoast_cache_entry;
+
+typedef struct
+{
+	MemoryContextCallback cb;	/* unregisters cache on reset of the context */
+	MemoryContext context;
+	int			n_entries;
+	int			next;			/* entry to be replaced */
+	vops_detoast_cache_entry entries[VOPS_DETOAST_CACHE_SIZE];
+} vops_detoast_cache;
+
+/*
+ * Caches of memory contexts used by the backend. Expression may be evaluated in several contexts
+ * (for example per-tuple contexts of outer and inner plan nodes), so more than one is remembered.
+ */
+#define VOPS_DETOAST_CONTEXTS 4
+static vops_detoast_cache *vops_detoast_caches[VOPS_DETOAST_CONTEXTS];
+static int	vops_detoast_next_cache;
+
+static shmem_startup_hook_type prev_shmem_startup_hook;
+#if PG_VERSION_NUM>=150000
+static shmem_request_hook_type prev_shmem_request_hook;
+#endif
+
+static int
+vops_tile_cache_slots(void)
+{
+	return (int) ((Size) vops_tile_cache_size * 1024 / VOPS_TILE_CACHE_SLOT_SIZE);
+}
+
+static Size
+vops_tile_cache_hdr_size(int n_slots)
+{
+	return MAXALIGN(offsetof(vops_tile_cache_hdr, slots) + n_slots * sizeof(vops_tile_cache_slot));
+}
+
+static void
+vops_tile_cache_request(void)
+{
+	int			n_slots = vops_tile_cache_slots();
+
+	RequestAddinShmemSpace(vops_tile_cache_hdr_size(n_slots)
+						   + (Size) n_slots * VOPS_TILE_CACHE_SLOT_SIZE
+						   + hash_estimate_size(n_slots, sizeof(vops_tile_cache_entry)));
+	RequestNamedLWLockTranche("vops", 1);
+}
+
+#if PG_VERSION_NUM>=150000
+static void
+vops_tile_cache_shmem_request(void)
+{
+	if (prev_shmem_request_hook)
+		prev_shmem_request_hook();
+	vops_tile_cache_request();
+}
+#endif
+
+static void
+vops_tile_cache_shmem_startup(void)
+{
+	int			n_slots = vops_tile_cache_slots();
+	Size		hdr_size = vops_tile_cache_hdr_size(n_slots);
+	HASHCTL		info;
+	bool		found;
+
+	if (prev_shmem_startup_hook)
+		prev_shmem_startup_hook();
+
+	LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+	vops_tile_cache = (vops_tile_cache_hdr *) ShmemInitStruct("vops tile cache",
+															  hdr_size + (Size) n_slots * VOPS_TILE_CACHE_SLOT_SIZE,
+															  &found);
+	if (!found)
+	{
+		int			i;
+
+		vops_tile_cache->lock = &(GetNamedLWLockTranche("vops"))->lock;
+		vops_tile_cache->n_slots = n_slots;
+		vops_tile_cache->clock_hand = 0;
+		pg_atomic_init_u64(&vops_tile_cache->hits, 0);
+		pg_atomic_init_u64(&vops_tile_cache->misses, 0);
+		for (i = 0; i < VOPS_TILE_CACHE_GENERATIONS; i++)
+			pg_atomic_init_u32(&vops_tile_cache->generations[i], 0);
+		for (i = 0; i < n_slots; i++)
+		{
+			vops_tile_cache->slots[i].size = 0;
+			pg_atomic_init_u32(&vops_tile_cache->slots[i].usage_count, 0);
+		}
+	}
+	memset(&info, 0, sizeof(info));
+	info.keysize = sizeof(vops_tile_cache_key);
+	info.entrysize = sizeof(vops_tile_cache_entry);
+	vops_tile_cache_hash = ShmemInitHash("vops tile cache hash",
+										 n_slots, n_slots,
+										 &info,
+										 HASH_ELEM | HASH_BLOBS);
+	LWLockRelease(AddinShmemInitLock);
+	vops_tile_cache_data = (char *) vops_tile_cache + hdr_size;
+}
+
+static pg_atomic_uint32 *
+vops_tile_cache_generation(Oid dbid, Oid relid)
+{
+	return &vops_tile_cache->generations[(dbid * 31 + relid) % VOPS_TILE_CACHE_GENERATIONS];
+}
+
+/*
+ * Relation is truncated, rewritten, vacuumed or dropped: values of its TOAST relation may be removed
+ * and their identifiers reused, so tiles loaded before are not valid any more.
+ * Vacuum which removes dead TOAST values updates statistic of TOAST relation in pg_class, so it is also
+ * followed by relcache invalidation.
+ */
+static void
+vops_tile_cache_invalidate(Datum arg, Oid relid)
+{
+	if (vops_tile_cache == NULL)
+		return;
+
+	if (relid == InvalidOid)
+	{
+		/* Invalidation of all relations */
+		int			i;
+
+		for (i = 0; i < VOPS_TILE_CACHE_GENERATIONS; i++)
+			pg_atomic_fetch_add_u32(&vops_tile_cache->generations[i], 1);
+	}
+	else
+		pg_atomic_fetch_add_u32(vops_tile_cache_generation(MyDatabaseId, relid), 1);
+}
+
+/*
+ * Choose slot for the new tile using clock-sweep algorithm.
+ * Should be called with exclusive lock held.
+ */
+static int
+vops_tile_cache_victim(void)
+{
+	while (true)
+	{
+		int			slot_no = vops_tile_cache->clock_hand;
+		vops_tile_cache_slot *slot = &vops_tile_cache->slots[slot_no];
+
+		vops_tile_cache->clock_hand = (slot_no + 1) % vops_tile_cache->n_slots;
+		if (slot->size == 0)
+			return slot_no;
+		if (pg_atomic_read_u32(&slot->usage_count) == 0)
+		{
+			hash_search(vops_tile_cache_hash, &slot->key, HASH_REMOVE, NULL);
+			slot->size = 0;
+			return slot_no;
+		}
+		pg_atomic_sub_fetch_u32(&slot->usage_count, 1);
+	}
+}
+
+/*
+ * Get detoasted tile. Tiles stored in TOAST or compressed inline are taken from the shared cache if present.
+ * Returned tile is always palloc'ed copy, so it is not affected by cache replacement.
+ */
+static struct varlena *
+vops_detoast_tile_shared(struct varlena *attr)
+{
+	vops_tile_cache_key key;
+	vops_tile_cache_entry *entry;
+	vops_tile_cache_slot *slot;
+	struct varlena *result;
+	char	   *data;
+	uint32		image_size;
+	uint32		generation;
+	bool		found;
+
+	if (vops_tile_cache == NULL)
+		return (struct varlena *) pg_detoast_datum(attr);
+
+	memset(&key, 0, sizeof(key));
+	if (VARATT_IS_EXTERNAL_ONDISK(attr))
+	{
+		struct varatt_external toast_pointer;
+
+		VARATT_EXTERNAL_GET_POINTER(toast_pointer, attr);
+		key.dbid = MyDatabaseId;
+		key.toastrelid = toast_pointer.va_toastrelid;
+		key.valueid = toast_pointer.va_valueid;
+		image_size = 0;
+		generation = pg_atomic_read_u32(vops_tile_cache_generation(key.dbid, key.toastrelid));
+	}
+	else if (VARATT_IS_COMPRESSED(attr))
+	{
+		/* Compressed datum identifies itself, so it never becomes stale */
+		image_size = VARSIZE(attr);
+		key.valueid = DatumGetUInt32(hash_any((unsigned char *) attr, image_size));
+		generation = 0;
+	}
+	else
+		return (struct varlena *) pg_detoast_datum(attr);
+
+	if (toast_raw_datum_size(PointerGetDatum(attr)) + image_size > VOPS_TILE_CACHE_SLOT_SIZE)
+		return (struct varlena *) pg_detoast_datum(attr);
+
+	LWLockAcquire(vops_tile_cache->lock, LW_SHARED);
+	entry = (vops_tile_cache_entry *) hash_search(vops_tile_cache_hash, &key, HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		slot = &vops_tile_cache->slots[entry->slot];
+		data = vops_tile_cache_data + (Size) entry->slot * VOPS_TILE_CACHE_SLOT_SIZE;
+		if (slot->generation == generation
+			&& slot->image_size == image_size
+			&& memcmp(data + slot->size, attr, image_size) == 0)
+		{
+			result = (struct varlena *) palloc(slot->size);
+			memcpy(result, data, slot->size);
+			if (pg_atomic_read_u32(&slot->usage_count) < VOPS_TILE_CACHE_MAX_USAGE)
+				pg_atomic_fetch_add_u32(&slot->usage_count, 1);
+			LWLockRelease(vops_tile_cache->lock);
+			pg_atomic_fetch_add_u64(&vops_tile_cache->hits, 1);
+			return result;
+		}
+	}
+	LWLockRelease(vops_tile_cache->lock);
+	pg_atomic_fetch_add_u64(&vops_tile_cache->misses, 1);
+
+	result = (struct varlena *) pg_detoast_datum(attr);
+	if (VARSIZE(result) + image_size > VOPS_TILE_CACHE_SLOT_SIZE)
+		return result;
+
+	LWLockAcquire(vops_tile_cache->lock, LW_EXCLUSIVE);
+	entry = (vops_tile_cache_entry *) hash_search(vops_tile_cache_hash, &key, HASH_FIND, NULL);
+	if (entry != NULL)
+	{
+		/* Tile may be loaded by some other backend in the meantime */
+		slot = &vops_tile_cache->slots[entry->slot];
+		if (slot->generation == generation && slot->image_size == image_size
+			&& memcmp(vops_tile_cache_data + (Size) entry->slot * VOPS_TILE_CACHE_SLOT_SIZE + slot->size,
+					  attr, image_size) == 0)
+		{
+			LWLockRelease(vops_tile_cache->lock);
+			return result;
+		}
+		/* Otherwise slot contains stale tile or tile with the same hash: overwrite it */
+	}
+	else
+	{
+		int			slot_no = vops_tile_cache_victim();
+
+		entry = (vops_tile_cache_entry *) hash_search(vops_tile_cache_hash, &key, HASH_ENTER, &found);
+		Assert(!found);
+		entry->slot = slot_no;
+		slot = &vops_tile_cache->slots[slot_no];
+		slot->key = key;
+	}
+	/*
+	 * Generation is taken before the tile was detoasted, so if relation was invalidated in the meantime,
+	 * tile is ignored by the next lookup.
+	 */
+	slot->size = VARSIZE(result);
+	slot->image_size = image_size;
+	slot->generation = generation;
+	pg_atomic_write_u32(&slot->usage_count, 1);
+	data = vops_tile_cache_data + (Size) entry->slot * VOPS_TILE_CACHE_SLOT_SIZE;
+	memcpy(data, result, slot->size);
+	memcpy(data + slot->size, attr, image_size);
+	LWLockRelease(vops_tile_cache->lock);
+	return result;
+}
+
+static void
+vops_detoast_cache_reset(void *arg)
+{
+	int			i;
+
+	/* Cache itself is allocated in the context being reset */
+	for (i = 0; i < VOPS_DETOAST_CONTEXTS; i++)
+	{
+		if (vops_detoast_caches[i] == (vops_detoast_cache *) arg)
+			vops_detoast_caches[i] = NULL;
+	}
+}
+
+/*
+ * Get cache of tiles detoasted in the current memory context.
+ * Cache is allocated in this context and forgotten on its reset.
+ */
+static vops_detoast_cache *
+vops_get_detoast_cache(void)
+{
+	vops_detoast_cache *cache;
+	int			i;
+
+	for (i = 0; i < VOPS_DETOAST_CONTEXTS; i++)
+	{
+		if (vops_detoast_caches[i] != NULL && vops_detoast_caches[i]->context == CurrentMemoryContext)
+			return vops_detoast_caches[i];
+	}
+	cache = (vops_detoast_cache *) palloc0(sizeof(vops_detoast_cache));
+	cache->cb.func = vops_detoast_cache_reset;
+	cache->cb.arg = cache;
+	cache->context = CurrentMemoryContext;
+	MemoryContextRegisterResetCallback(CurrentMemoryContext, &cache->cb);
+
+	/*
+	 * Replaced cache stays valid until reset of its context, it is just not reused any more.
+	 */
+	vops_detoast_caches[vops_detoast_next_cache] = cache;
+	vops_detoast_next_cache = (vops_detoast_next_cache + 1) % VOPS_DETOAST_CONTEXTS;
+	return cache;
+}
+
+/*
+ * Get detoasted tile.
+ * Tile is detoasted at most once until reset of current memory context.
+ */
+struct varlena *
+vops_detoast_tile(Datum datum)
+{
+	struct varlena *attr = (struct varlena *) DatumGetPointer(datum);
+	vops_detoast_cache *cache;
+	vops_detoast_cache_entry *entry;
+	Size		size;
+	int			i;
+
+	if (!VARATT_IS_EXTERNAL(attr) && !VARATT_IS_COMPRESSED(attr))
+		return (struct varlena *) pg_detoast_datum(attr);
+
+	size = VARSIZE_ANY(attr);
+	cache = vops_get_detoast_cache();
+	for (i = 0; i < cache->n_entries; i++)
+	{
+		entry = &cache->entries[i];
+		if (VARSIZE_ANY(entry->toasted) == size && memcmp(entry->toasted, attr, size) == 0)
+			return entry->detoasted;
+	}
+	/*
+	 * Entries are allocated in the current memory context and released only on its reset:
+	 * evicted tile may still be referenced by the caller.
+	 */
+	entry = &cache->entries[cache->next];
+	cache->next = (cache->next + 1) % VOPS_DETOAST_CACHE_SIZE;
+	if (cache->n_entries < VOPS_DETOAST_CACHE_SIZE)
+		cache->n_entries += 1;
+	entry->toasted = (struct varlena *) palloc(size);
+	memcpy(entry->toasted, attr, size);
+	entry->detoasted = vops_detoast_tile_shared(attr);
+	return entry->detoasted;
+}
+
+PG_FUNCTION_INFO_V1(vops_tile_cache_stats);
+Datum
+vops_tile_cache_stats(PG_FUNCTION_ARGS)
+{
+	TupleDesc	desc;
+	Datum		values[5];
+	bool		nulls[5] = {false};
+	uint64		hits = 0;
+	uint64		misses = 0;
+	int			used = 0;
+	int			n_slots = 0;
+
+	if (get_call_result_type(fcinfo, NULL, &desc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	if (vops_tile_cache != NULL)
+	{
+		int			i;
+
+		hits = pg_atomic_read_u64(&vops_tile_cache->hits);
+		misses = pg_atomic_read_u64(&vops_tile_cache->misses);
+		n_slots = vops_tile_cache->n_slots;
+		LWLockAcquire(vops_tile_cache->lock, LW_SHARED);
+		for (i = 0; i < n_slots; i++)
+		{
+			used += vops_tile_cache->slots[i].size != 0;
+		}
+		LWLockRelease(vops_tile_cache->lock);
+	}
+	values[0] = Int64GetDatum(hits);
+	values[1] = Int64GetDatum(misses);
+	values[2] = Float8GetDatum(hits + misses == 0 ? 0.0 : (double) hits / (hits + misses));
+	values[3] = Int32GetDatum(used);
+	values[4] = Int32GetDatum(n_slots);
+	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(BlessTupleDesc(desc), values, nulls)));
+}
+
+void
+vops_tile_cache_init(void)
+{
+	DefineCustomIntVariable("vops.tile_cache_size",
+							"Size of shared cache of detoasted tiles",
+							"Cache is used only if VOPS is loaded using shared_preload_libraries",
+							&vops_tile_cache_size,
+							0,
+							0,
+							MAX_KILOBYTES,
+							PGC_POSTMASTER,
+							GUC_UNIT_KB,
+							NULL,
+							NULL,
+							NULL);
+
+	if (!process_shared_preload_libraries_in_progress || vops_tile_cache_slots() == 0)
+		return;
+
+#if PG_VERSION_NUM>=150000
+	prev_shmem_request_hook = shmem_request_hook;
+	shmem_request_hook = vops_tile_cache_shmem_request;
+#else
+	vops_tile_cache_request();
+#endif
+	prev_shmem_startup_hook = shmem_startup_hook;
+	shmem_startup_hook = vops_tile_cache_shmem_startup;
+	CacheRegisterRelcacheCallback(vops_tile_cache_invalidate, (Datum) 0);
+}
@@ -12,14 +12,26 @@
  */
 #include "postgres.h"
 
+#include <float.h>
+#include <math.h>
+
 #include "vops_fdw.h"
 
+#include "access/genam.h"
+#include "access/heapam.h"
 #include "access/htup_details.h"
+#include "access/nbtree.h"
+#include "access/parallel.h"
 #include "access/sysattr.h"
 #include "access/reloptions.h"
+#include "catalog/indexing.h"
+#include "catalog/namespace.h"
+#include "catalog/pg_am.h"
 #include "catalog/pg_class.h"
+#include "catalog/pg_extension.h"
 #include "catalog/pg_foreign_server.h"
 #include "catalog/pg_foreign_table.h"
+#include "catalog/pg_type.h"
 #include "commands/defrem.h"
 #include "commands/explain.h"
 #include "commands/vacuum.h"
@@ -41,6 +53,7 @@
 #include "optimizer/restrictinfo.h"
 #if PG_VERSION_NUM>=120000
 #include "access/table.h"
+#include "access/tableam.h"
 #include "nodes/primnodes.h"
 #include "optimizer/optimizer.h"
 #else
@@ -48,16 +61,36 @@
 #endif
 #include "optimizer/tlist.h"
 #include "parser/parsetree.h"
+#include "storage/bufmgr.h"
 #include "utils/builtins.h"
+#include "utils/fmgroids.h"
 #include "utils/guc.h"
 #include "utils/lsyscache.h"
 #include "utils/memutils.h"
 #include "utils/rel.h"
 #include "utils/sampling.h"
 #include "utils/selfuncs.h"
+#include "utils/snapmgr.h"
+#if PG_VERSION_NUM>=100000
+#include "utils/varlena.h"
+#endif
+#include "utils/datum.h"
 #include "executor/spi.h"
+#include "tcop/pquery.h"
 #include "vops.h"
 
+#if PG_VERSION_NUM<120000
+#define TableScanDesc HeapScanDesc
+#define table_beginscan(rel, snapshot, nkeys, keys) heap_beginscan(rel, snapshot, nkeys, keys)
+#define table_rescan(scan, keys) heap_rescan(scan, keys)
+#define table_endscan(scan) heap_endscan(scan)
+#define ParallelTableScanDesc ParallelHeapScanDesc
+#define table_parallelscan_estimate(rel, snapshot) heap_parallelscan_estimate(snapshot)
+#define table_parallelscan_initialize(rel, pscan, snapshot) heap_parallelscan_initialize(pscan, rel, snapshot)
+#define table_parallelscan_reinitialize(rel, pscan) heap_parallelscan_reinitialize(pscan)
+#define table_beginscan_parallel(rel, pscan) heap_beginscan_parallel(rel, pscan)
+#endif
+
 /*
  * Indexes of FDW-private information stored in fdw_private lists.
  *
@@ -70,7 +103,17 @@ enum FdwScanPrivateIndex
 	/* SQL statement to execute remotely (as a String node) */
 	FdwScanPrivateSelectSql,
 	/* Integer list of attribute numbers retrieved by the SELECT */
-	FdwScanPrivateRetrievedAttrs
+	FdwScanPrivateRetrievedAttrs,
+	/* Integer flag: scan VOPS table directly instead of executing SELECT */
+	FdwScanPrivateDirectScan,
+	/* Integer flag: aggregates are calculated by the SELECT */
+	FdwScanPrivateGrouped,
+	/* Integer index of vops_bool column with mask of selected tile elements (-1 if none) */
+	FdwScanPrivateMaskColumn,
+	/* Integer flag: VOPS tuples are sorted in descending order of key */
+	FdwScanPrivateReverse,
+	/* Integer attribute number of the key VOPS tuples are sorted by (0 if none) */
+	FdwScanPrivateOrderKey
 };
 
 /*
@@ -88,20 +131,70 @@ typedef struct PgFdwScanState
 
 	/* for remote query execution */
 	Portal      portal;			/* SPI portal */
+	bool        grouped;		/* aggregates are calculated by VOPS query */
+	int         mask_column;	/* column of VOPS query with mask of join conditions (-1 if none) */
+	bool        reverse;		/* return elements of tiles in descending order */
+	int         order_key;		/* attribute of the sort key (-1 if rows are not sorted) */
+	FmgrInfo    order_cmp;		/* btree comparison function of the sort key */
+	bool        has_last_key;	/* some row was already returned */
+	bool        last_key_null;
+	Datum       last_key;		/* sort key of the last returned row */
 	int			numParams;		/* number of parameters passed to query */
-	int         tile_pos;
-	uint64      table_pos;
-	HeapTuple   spi_tuple;
-	Datum*      src_values;
-	Datum*      dst_values;
-	bool*       src_nulls;
-	bool*       dst_nulls;
+	MemoryContext spi_context;
+
+	/* for direct scan of VOPS table */
+	bool        direct;			/* VOPS table is scanned without SPI */
+	Relation    vops_rel;		/* VOPS table */
+	TableScanDesc scan;
+	Snapshot    snapshot;
+	bool        scan_done;		/* all tuples of VOPS table are fetched */
+	struct vops_scan_pred* quals;	/* compiled pushed down conditions (NULL if none) */
+	int*        qual_attnos;	/* column of VOPS table for each attribute used by conditions */
+
+	/* batch of fetched tuples */
+	int         n_src_attrs;	/* number of columns returned by VOPS query */
+	int*        src_attnos;		/* column of VOPS query for each attribute (-1 if not retrieved) */
 	vops_type*  vops_types;
 	Oid*        attr_types;
-	MemoryContext spi_context;
-	uint64      filter_mask;
+	Datum*      batch_values;	/* batch_size*n_src_attrs values */
+	bool*       batch_nulls;
+	uint64*     batch_masks;	/* filter mask of each fetched tuple */
+	uint64      batch_size;
+	uint64      batch_rows;		/* number of tuples in the batch */
+	uint64      batch_pos;		/* current tuple in the batch */
+	MemoryContext batch_context;
+	uint64      row_mask;		/* positions of current tuple which are not yet returned */
+	text**      texts;			/* buffers for elements of text tiles */
+	int*        text_sizes;
 } PgFdwScanState;
 
+/*
+ * Number of VOPS tuples fetched from cursor at once
+ */
+#define VOPS_FDW_BATCH_SIZE 256
+
+/*
+ * Receiver of tuples fetched from cursor: it remembers for each tuple
+ * filter mask calculated by WHERE clause of VOPS query.
+ */
+typedef struct VopsFdwReceiver
+{
+	DestReceiver pub;
+	PgFdwScanState* fsstate;
+} VopsFdwReceiver;
+
+/*
+ * Cost model parameters: vector operators and aggregates are applied to the
+ * whole tile, while unnest is performed for each selected row.
+ * Defaults are derived from TPC-H timings given in README: vectorized Q6
+ * (dominated by filter) is 19 times faster than original query and Q1
+ * (dominated by aggregates) is 11 times faster, so tile of 64 elements costs
+ * 64*cpu_operator_cost/19 and 64*cpu_operator_cost/11 respectively.
+ */
+double vops_tile_operator_cost = 0.0085;
+static double vops_tile_aggregate_cost = 0.015;
+static double vops_unnest_row_cost = 0.0025;
+
 /*
  * SQL functions
  */
@@ -130,6 +223,12 @@ static void postgresReScanForeignScan(ForeignScanState *node);
 static void postgresEndForeignScan(ForeignScanState *node);
 static void postgresExplainForeignScan(ForeignScanState *node,
 						   ExplainState *es);
+static void postgresGetForeignJoinPaths(PlannerInfo *root,
+										RelOptInfo *joinrel,
+										RelOptInfo *outerrel,
+										RelOptInfo *innerrel,
+										JoinType jointype,
+										JoinPathExtraData *extra);
 #if PG_VERSION_NUM>=110000
 static void postgresGetForeignUpperPaths(PlannerInfo *root,
 										 UpperRelationKind stage,
@@ -149,6 +248,19 @@ static bool postgresIsForeignScanParallelSafe(PlannerInfo *root, RelOptInfo *rel
 static bool postgresAnalyzeForeignTable(Relation relation,
 							AcquireSampleRowsFunc *func,
 							BlockNumber *totalpages);
+#if PG_VERSION_NUM>=110000
+static Size postgresEstimateDSMForeignScan(ForeignScanState *node,
+										   ParallelContext *pcxt);
+static void postgresInitializeDSMForeignScan(ForeignScanState *node,
+											 ParallelContext *pcxt,
+											 void *coordinate);
+static void postgresReInitializeDSMForeignScan(ForeignScanState *node,
+											   ParallelContext *pcxt,
+											   void *coordinate);
+static void postgresInitializeWorkerForeignScan(ForeignScanState *node,
+												shm_toc *toc,
+												void *coordinate);
+#endif
 /*
  * Helper functions
  */
@@ -163,6 +275,10 @@ static bool foreign_grouping_ok(PlannerInfo *root, RelOptInfo *grouped_rel);
 static void add_foreign_grouping_paths(PlannerInfo *root,
 						   RelOptInfo *input_rel,
 						   RelOptInfo *grouped_rel);
+static void vopsFdwInitDirectTypes(PgFdwScanState *fsstate);
+static bool vops_uses_tiles(PlannerInfo *root, RelOptInfo *rel, List *clauses);
+static bool vops_contains_bool_expr(Node *node, void *context);
+static List *vops_get_ordered_pathkeys(PlannerInfo *root, RelOptInfo *baserel);
 static int postgresAcquireSampleRowsFunc(Relation relation, int elevel,
 							  HeapTuple *rows, int targrows,
 							  double *totalrows,
@@ -187,6 +303,12 @@ vops_fdw_handler(PG_FUNCTION_ARGS)
 	routine->ReScanForeignScan = postgresReScanForeignScan;
 	routine->EndForeignScan = postgresEndForeignScan;
 	routine->IsForeignScanParallelSafe = postgresIsForeignScanParallelSafe;
+#if PG_VERSION_NUM>=110000
+	routine->EstimateDSMForeignScan = postgresEstimateDSMForeignScan;
+	routine->InitializeDSMForeignScan = postgresInitializeDSMForeignScan;
+	routine->ReInitializeDSMForeignScan = postgresReInitializeDSMForeignScan;
+	routine->InitializeWorkerForeignScan = postgresInitializeWorkerForeignScan;
+#endif
 
 	/* Support functions for ANALYZE */
 	routine->AnalyzeForeignTable = postgresAnalyzeForeignTable;
@@ -194,12 +316,59 @@ vops_fdw_handler(PG_FUNCTION_ARGS)
 	/* Support functions for EXPLAIN */
 	routine->ExplainForeignScan = postgresExplainForeignScan;
 
+	/* Support functions for join push-down */
+	routine->GetForeignJoinPaths = postgresGetForeignJoinPaths;
+
 	/* Support functions for upper relation push-down */
 	routine->GetForeignUpperPaths = postgresGetForeignUpperPaths;
 
 	PG_RETURN_POINTER(routine);
 }
 
+/*
+ * Register configuration parameters of VOPS FDW cost model
+ */
+void
+vops_fdw_init(void)
+{
+	DefineCustomRealVariable("vops.tile_operator_cost",
+							 "Sets the planner's estimate of the cost of applying vector operator to one tile",
+							 NULL,
+							 &vops_tile_operator_cost,
+							 0.0085,
+							 0,
+							 DBL_MAX,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+	DefineCustomRealVariable("vops.tile_aggregate_cost",
+							 "Sets the planner's estimate of the cost of accumulating one tile by aggregate",
+							 NULL,
+							 &vops_tile_aggregate_cost,
+							 0.015,
+							 0,
+							 DBL_MAX,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+	DefineCustomRealVariable("vops.unnest_row_cost",
+							 "Sets the planner's estimate of the cost of extracting one row from tiles",
+							 NULL,
+							 &vops_unnest_row_cost,
+							 0.0025,
+							 0,
+							 DBL_MAX,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+}
+
 
 Datum
 vops_fdw_validator(PG_FUNCTION_ARGS)
@@ -235,7 +404,7 @@ vops_fdw_validator(PG_FUNCTION_ARGS)
 }	
 
 
-static Relation open_vops_relation(ForeignTable* table)
+static Relation open_vops_relation(ForeignTable* table, LOCKMODE lockmode)
 {
 	ListCell   *lc;
 	char       *nspname = NULL;
@@ -257,7 +426,7 @@ static Relation open_vops_relation(ForeignTable* table)
 		nspname = get_namespace_name(get_rel_namespace(table->relid));
 	}
 	rv = makeRangeVar(nspname, relname, -1);
-	return heap_openrv_extended(rv, RowExclusiveLock, false);
+	return heap_openrv_extended(rv, lockmode, false);
 }
 
 /*
@@ -305,9 +474,13 @@ postgresGetForeignRelSize(PlannerInfo *root,
 	 */
 	fpinfo->tile_attrs = NULL;
 	fpinfo->vops_attrs = NULL;
+	fpinfo->rowgroup_attrs = NULL;
+	fpinfo->rowgroup_name = NULL;
 
-	vops_rel = open_vops_relation(fpinfo->table);
+	vops_rel = open_vops_relation(fpinfo->table, RowExclusiveLock);
 	fdw_rel = heap_open(rte->relid, NoLock);
+	fpinfo->vops_relid = RelationGetRelid(vops_rel);
+	fpinfo->vops_pages = RelationGetNumberOfBlocks(vops_rel);
 	
 	estimate_rel_size(vops_rel, baserel->attr_widths, 
 					  &baserel->pages, &baserel->tuples, &baserel->allvisfrac);
@@ -317,6 +490,15 @@ postgresGetForeignRelSize(PlannerInfo *root,
 	vops_tupdesc = RelationGetDescr(vops_rel);
 	fdw_tupdesc = RelationGetDescr(fdw_rel);
 
+	for (j = 0; j < vops_tupdesc->natts; j++)
+	{
+		if (vops_is_rowgroup_type(TupleDescAttr(vops_tupdesc, j)->atttypid))
+		{
+			fpinfo->rowgroup_name = pstrdup(NameStr(TupleDescAttr(vops_tupdesc, j)->attname));
+			break;
+		}
+	}
+
 	for (i = 0; i < fdw_tupdesc->natts; i++) 
 	{
 		for (j = 0; j < vops_tupdesc->natts; j++) 
@@ -328,8 +510,19 @@ postgresGetForeignRelSize(PlannerInfo *root,
 				{
 					fpinfo->tile_attrs = bms_add_member(fpinfo->tile_attrs, i + 1 - FirstLowInvalidHeapAttributeNumber);
 				}						
+				break;
 			}
 		}
+		/*
+		 * Attributes not present in VOPS table are extracted from its row group.
+		 * They are not pushed down, but only referenced column chunks are fetched.
+		 */
+		if (j == vops_tupdesc->natts && fpinfo->rowgroup_name != NULL
+			&& !TupleDescAttr(fdw_tupdesc, i)->attisdropped
+			&& vops_get_tile_type(TupleDescAttr(fdw_tupdesc, i)->atttypid) != InvalidOid)
+		{
+			fpinfo->rowgroup_attrs = bms_add_member(fpinfo->rowgroup_attrs, i + 1 - FirstLowInvalidHeapAttributeNumber);
+		}
 	}		
     heap_close(fdw_rel, NoLock);
     heap_close(vops_rel, RowExclusiveLock);
@@ -361,6 +554,14 @@ postgresGetForeignRelSize(PlannerInfo *root,
 					   &fpinfo->attrs_used);
 	}
 
+	/* Check if tiles of VOPS table are used by the scan */
+	fpinfo->tile_relid = 0;
+	if (vops_uses_tiles(root, baserel, fpinfo->remote_conds)
+		|| bms_overlap(fpinfo->attrs_used, fpinfo->tile_attrs)
+		|| bms_overlap(fpinfo->attrs_used, fpinfo->rowgroup_attrs))
+	{
+		fpinfo->tile_relid = baserel->relid;
+	}
 
 	/*
 	 * Compute the selectivity and cost of the local_conds, so we don't have
@@ -386,7 +587,7 @@ postgresGetForeignRelSize(PlannerInfo *root,
 	/* Estimate baserel size as best we can with local statistics. */
 	set_baserel_size_estimates(root, baserel);
 	
-	/* Fill in basically-bogus cost estimates for use later. */
+	/* Fill in cost estimates for use later. */
 	estimate_path_cost_size(root, baserel, NIL, NIL,
 							&fpinfo->rows, &fpinfo->width,
 							&fpinfo->startup_cost, &fpinfo->total_cost);
@@ -426,6 +627,7 @@ postgresGetForeignPaths(PlannerInfo *root,
 {
 	PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) baserel->fdw_private;
 	ForeignPath *path;
+	List	   *pathkeys;
 
 	/*
 	 * Create simplest ForeignScan path node and add it to baserel.  This path
@@ -448,6 +650,77 @@ postgresGetForeignPaths(PlannerInfo *root,
 #endif
 								   NIL);		/* no fdw_private list */
 	add_path(baserel, (Path *) path);
+
+	/*
+	 * If VOPS table is sorted by the first key of the query, then sort can be
+	 * performed by VOPS query for tiles rather than for unnested rows.
+	 * Filter mask is not preserved by sort, so it is possible only if there
+	 * are no remote conditions.
+	 */
+	pathkeys = fpinfo->remote_conds == NIL ? vops_get_ordered_pathkeys(root, baserel) : NIL;
+	if (pathkeys != NIL)
+	{
+		double n_tiles = Max(baserel->tuples / TILE_SIZE, 2);
+		path = create_foreignscan_path(root,
+									   baserel,
+									   NULL,		/* default pathtarget */
+									   fpinfo->rows,
+									   fpinfo->startup_cost,
+									   fpinfo->total_cost + 2.0 * cpu_operator_cost * n_tiles * log2(n_tiles),
+									   pathkeys,
+									   NULL,		/* no outer rel either */
+									   NULL,		/* no extra plan */
+#if PG_VERSION_NUM>=170000
+									   NIL,			/* no fdw_restrictinfo list */
+#endif
+									   NIL);		/* no fdw_private list */
+		add_path(baserel, (Path *) path);
+	}
+
+#if PG_VERSION_NUM>=110000
+	/*
+	 * If VOPS table can be scanned directly, then its blocks can be
+	 * distributed between parallel workers like in parallel sequential scan.
+	 * Number of workers is determined by actual size of VOPS table rather
+	 * than by estimation of its pages.
+	 */
+	if (baserel->consider_parallel
+		&& fpinfo->remote_conds == NIL
+		&& !bms_overlap(fpinfo->attrs_used, fpinfo->rowgroup_attrs))
+	{
+		int parallel_workers = compute_parallel_worker(baserel, fpinfo->vops_pages, -1,
+													   max_parallel_workers_per_gather);
+		if (parallel_workers > 0)
+		{
+			double divisor = parallel_workers;
+			double leader_contribution;
+
+			if (parallel_leader_participation)
+			{
+				leader_contribution = 1.0 - (0.3 * parallel_workers);
+				if (leader_contribution > 0)
+					divisor += leader_contribution;
+			}
+			path = create_foreignscan_path(root,
+										   baserel,
+										   NULL,		/* default pathtarget */
+										   clamp_row_est(fpinfo->rows / divisor),
+										   fpinfo->startup_cost,
+										   fpinfo->startup_cost + (fpinfo->total_cost - fpinfo->startup_cost) / divisor,
+										   NIL,			/* no pathkeys */
+										   NULL,		/* no outer rel either */
+										   NULL,		/* no extra plan */
+#if PG_VERSION_NUM>=170000
+										   NIL,			/* no fdw_restrictinfo list */
+#endif
+										   NIL);		/* no fdw_private list */
+			path->path.parallel_aware = true;
+			path->path.parallel_safe = true;
+			path->path.parallel_workers = parallel_workers;
+			add_partial_path(baserel, (Path *) path);
+		}
+	}
+#endif
 }
 
 /*
@@ -474,6 +747,7 @@ postgresGetForeignPlan(PlannerInfo *root,
 	ListCell   *lc;
 	List	   *fdw_scan_tlist = NIL;
 	StringInfoData sql;
+	bool		direct;
 
 	/*
 	 * For base relations, set scan_relid as the relid of the relation. For
@@ -550,6 +824,22 @@ postgresGetForeignPlan(PlannerInfo *root,
 		fdw_scan_tlist = vops_build_tlist_to_deparse(foreignrel);
 	}
 
+	/*
+	 * Each VOPS tuple produces at least one row. So if there are no conditions
+	 * and the scan returns rows in the order requested by the query (if any),
+	 * then LIMIT of the query can be applied to VOPS tuples.
+	 */
+	fpinfo->limit_tuples = 0;
+	if (scan_relid > 0
+		&& root->limit_tuples > 0
+		&& bms_membership(root->all_baserels) == BMS_SINGLETON
+		&& remote_conds == NIL
+		&& local_exprs == NIL
+		&& pathkeys_contained_in(root->query_pathkeys, best_path->path.pathkeys))
+	{
+		fpinfo->limit_tuples = root->limit_tuples;
+	}
+
 	/*
 	 * Build the query string to be sent for execution, and identify
 	 * expressions to be sent as parameters.
@@ -558,13 +848,41 @@ postgresGetForeignPlan(PlannerInfo *root,
 	vopsDeparseSelectStmtForRel(&sql, root, foreignrel, fdw_scan_tlist,
 							remote_conds, best_path->path.pathkeys,
 							&retrieved_attrs, &params_list);
-	elog(LOG, "Execute VOPS query %s", sql.data);
+
+	/*
+	 * If nothing except simple conditions is pushed down to VOPS query, then
+	 * it just unnests tiles of VOPS table. In this case executor can read VOPS
+	 * table itself, avoiding parse, plan and execution of the query through SPI.
+	 * Conditions are compiled into vector predicate as in VopsScan.
+	 */
+	direct = scan_relid > 0
+#if PG_VERSION_NUM>=120000
+		&& (remote_conds == NIL || vops_scan_compile_quals(remote_conds, scan_relid) != NULL)
+#else
+		&& remote_conds == NIL
+#endif
+		&& params_list == NIL
+		&& best_path->path.pathkeys == NIL
+		&& !bms_overlap(fpinfo->attrs_used, fpinfo->rowgroup_attrs);
+	if (!direct) {
+		elog(LOG, "Execute VOPS query %s", sql.data);
+	}
+	/* Parallel scan is possible only for direct scan of VOPS table */
+	Assert(direct || !best_path->path.parallel_aware);
 
 	/*
 	 * Build the fdw_private list that will be available to the executor.
 	 * Items in the list must match order in enum FdwScanPrivateIndex.
 	 */
-	fdw_private = list_make2(makeString(sql.data), retrieved_attrs);
+	fdw_private = list_make4(makeString(sql.data), retrieved_attrs, makeInteger(direct),
+							 makeInteger(foreignrel->reloptkind == RELOPT_UPPER_REL));
+	fdw_private = lappend(fdw_private,
+						  makeInteger(fpinfo->mask_conds != NIL ? list_length(fdw_scan_tlist) : -1));
+	fdw_private = lappend(fdw_private,
+						  makeInteger(best_path->path.pathkeys != NIL
+									  && VOPS_PATHKEY_DESC((PathKey *) linitial(best_path->path.pathkeys))));
+	fdw_private = lappend(fdw_private,
+						  makeInteger(scan_relid > 0 && best_path->path.pathkeys != NIL ? fpinfo->order_key : 0));
 	/*
 	 * Create the ForeignScan node for the given relation.
 	 *
@@ -610,6 +928,11 @@ postgresBeginForeignScan(ForeignScanState *node, int eflags)
 	fsstate->query = strVal(list_nth(fsplan->fdw_private, FdwScanPrivateSelectSql));
 	fsstate->retrieved_attrs = (List *) list_nth(fsplan->fdw_private,
 												 FdwScanPrivateRetrievedAttrs);
+	fsstate->direct = intVal(list_nth(fsplan->fdw_private, FdwScanPrivateDirectScan)) != 0;
+	fsstate->grouped = intVal(list_nth(fsplan->fdw_private, FdwScanPrivateGrouped)) != 0;
+	fsstate->mask_column = intVal(list_nth(fsplan->fdw_private, FdwScanPrivateMaskColumn));
+	fsstate->reverse = intVal(list_nth(fsplan->fdw_private, FdwScanPrivateReverse)) != 0;
+	fsstate->order_key = intVal(list_nth(fsplan->fdw_private, FdwScanPrivateOrderKey)) - 1;
 
 	fsstate->spi_context = AllocSetContextCreate(estate->es_query_cxt,
 												 "vops_fdw spi context",
@@ -638,286 +961,749 @@ postgresBeginForeignScan(ForeignScanState *node, int eflags)
 	 */
 	numParams = list_length(fsplan->fdw_exprs);
 	fsstate->numParams = numParams;
-	fsstate->dst_values = palloc(fsstate->tupdesc->natts*sizeof(Datum));
-	fsstate->src_values = palloc(fsstate->tupdesc->natts*sizeof(Datum));
-	fsstate->dst_nulls = palloc(fsstate->tupdesc->natts*sizeof(bool));
-	fsstate->src_nulls = palloc(fsstate->tupdesc->natts*sizeof(bool));
-	/* Initialize to nulls for any columns not present in result */
-	memset(fsstate->dst_nulls, true, fsstate->tupdesc->natts*sizeof(bool));
-	
+	fsstate->batch_context = AllocSetContextCreate(estate->es_query_cxt,
+												   "vops_fdw batch context",
+												   ALLOCSET_DEFAULT_SIZES);
+	fsstate->texts = palloc0(fsstate->tupdesc->natts*sizeof(text*));
+	fsstate->text_sizes = palloc0(fsstate->tupdesc->natts*sizeof(int));
+
+	if (fsstate->order_key >= 0)
+	{
+		/* Sort key was checked by vops_get_ordered_pathkeys to have default btree operator class */
+		Oid opclass = GetDefaultOpClass(TupleDescAttr(fsstate->tupdesc, fsstate->order_key)->atttypid, BTREE_AM_OID);
+		Oid opcintype = get_opclass_input_type(opclass);
+		fmgr_info_cxt(get_opfamily_proc(get_opclass_family(opclass), opcintype, opcintype, BTORDER_PROC),
+					  &fsstate->order_cmp, fsstate->spi_context);
+	}
+
+	if (fsstate->direct)
+	{
+		fsstate->vops_rel = open_vops_relation(GetForeignTable(RelationGetRelid(fsstate->rel)), AccessShareLock);
+		fsstate->snapshot = estate->es_snapshot;
+#if PG_VERSION_NUM>=120000
+		fsstate->quals = vops_scan_compile_quals(fsplan->fdw_recheck_quals, fsplan->scan.scanrelid);
+#endif
+		vopsFdwInitDirectTypes(fsstate);
+		if (!fsstate->direct)
+		{
+			/* Columns of VOPS table do not match conditions: execute VOPS query */
+			heap_close(fsstate->vops_rel, AccessShareLock);
+			fsstate->vops_rel = NULL;
+		}
+	}
 	postgresReScanForeignScan(node);
 }
 
 /*
- * postgresIterateForeignScan
- *		Retrieve next row from the result set, or clear tuple slot to indicate
- *		EOF.
+ * Map columns of VOPS query to attributes of foreign table
  */
-static TupleTableSlot *
-postgresIterateForeignScan(ForeignScanState *node)
+static void
+vopsFdwInitTypes(PgFdwScanState *fsstate, TupleDesc src_desc)
 {
-	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
-	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+	int n_attrs = fsstate->tupdesc->natts;
 	int i, j;
-	HeapTuple tup;
 	ListCell *lc;
-	int n_attrs = fsstate->tupdesc->natts;
-	List* retrieved_attrs = fsstate->retrieved_attrs;
 	MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
 
-	while (true) {
-		if (fsstate->spi_tuple == NULL) { 
-			if (fsstate->portal != NULL) { 
-				filter_mask = ~0;
-				SPI_cursor_fetch(fsstate->portal, true, 1);
-				fsstate->table_pos = 0;
-			}
-			if (fsstate->table_pos == SPI_processed) {
-				MemoryContextSwitchTo(oldcontext);
-				return ExecClearTuple(slot);
-			}
-			if (fsstate->rel == NULL) { 
-				fsstate->tile_pos = TILE_SIZE-1;
-				fsstate->filter_mask = ~0;
-			} else {
-				fsstate->tile_pos = 0;
-				fsstate->filter_mask = filter_mask;
-			}
-			fsstate->spi_tuple = SPI_tuptable->vals[fsstate->table_pos++];
-			if (fsstate->vops_types == NULL) { 
-				fsstate->vops_types = palloc(sizeof(vops_type_info)*n_attrs);
-				fsstate->attr_types = palloc(sizeof(Oid)*n_attrs);
-				for (i = 0; i < n_attrs; i++) {
-					fsstate->vops_types[i] = VOPS_LAST;
-				}
-				j = 0;
-				foreach(lc, retrieved_attrs)
-				{
-					i = lfirst_int(lc);
-					if (i > 0)
-					{
-						/* ordinary column */
-						Assert(i <= n_attrs);
-						Assert(j < SPI_tuptable->tupdesc->natts);
-						fsstate->attr_types[i-1] = TupleDescAttr(SPI_tuptable->tupdesc, j)->atttypid;
-						fsstate->vops_types[i-1] = vops_get_type(fsstate->attr_types[i-1]);
-					}
-					j += 1;
-				}
-			}
-			j = 0;
-			foreach(lc, retrieved_attrs)
-			{
-				i = lfirst_int(lc);
-				if (i > 0)
-				{
-					/* ordinary column */
-					fsstate->src_values[i - 1] = SPI_getbinval(fsstate->spi_tuple, SPI_tuptable->tupdesc, j+1, &fsstate->src_nulls[i - 1]);
-				}
-				j += 1;
-			}
+	fsstate->n_src_attrs = src_desc->natts;
+	fsstate->src_attnos = palloc(sizeof(int)*n_attrs);
+	fsstate->vops_types = palloc(sizeof(vops_type)*n_attrs);
+	fsstate->attr_types = palloc(sizeof(Oid)*n_attrs);
+	for (i = 0; i < n_attrs; i++) {
+		fsstate->src_attnos[i] = -1;
+		fsstate->vops_types[i] = VOPS_LAST;
+		fsstate->attr_types[i] = InvalidOid;
+	}
+	j = 0;
+	foreach(lc, fsstate->retrieved_attrs)
+	{
+		i = lfirst_int(lc);
+		if (i > 0)
+		{
+			/* ordinary column */
+			Assert(i <= n_attrs);
+			Assert(j < src_desc->natts);
+			fsstate->src_attnos[i-1] = j;
+			fsstate->attr_types[i-1] = TupleDescAttr(src_desc, j)->atttypid;
+			fsstate->vops_types[i-1] = vops_get_type(fsstate->attr_types[i-1]);
 		}
-		for (j = fsstate->tile_pos; j < TILE_SIZE; j++) {
-			if (fsstate->filter_mask & ((uint64)1 << j)) 
-			{
-				for (i = 0; i < n_attrs; i++) {
-					if (fsstate->vops_types[i] != VOPS_LAST) {
-						vops_tile_hdr* tile = VOPS_GET_TILE(fsstate->src_values[i], fsstate->vops_types[i]);
-						if (tile != NULL && (tile->empty_mask & ((uint64)1 << j))) {
-							goto NextTuple;
-						}
-						if (tile == NULL || (tile->null_mask & ((uint64)1 << j))) {
-							fsstate->dst_nulls[i] = true;
-						} else {
-							Datum value = 0;
-							switch (fsstate->vops_types[i]) {
-							  case VOPS_BOOL:
-								value = BoolGetDatum((((vops_bool*)tile)->payload >> j) & 1);
-								break;
-							  case VOPS_CHAR:
-								value = CharGetDatum(((vops_char*)tile)->payload[j]);
-								break;
-							  case VOPS_INT2:
-								value = Int16GetDatum(((vops_int2*)tile)->payload[j]);
-								break;
-							  case VOPS_INT4:
-							  case VOPS_DATE:
-								value = Int32GetDatum(((vops_int4*)tile)->payload[j]);
-								break;
-							  case VOPS_INT8:
-							  case VOPS_INTERVAL:
-							  case VOPS_TIMESTAMP:
-								value = Int64GetDatum(((vops_int8*)tile)->payload[j]);
-								break;
-							  case VOPS_FLOAT4:
-								value = Float4GetDatum(((vops_float4*)tile)->payload[j]);
-								break;
-							  case VOPS_FLOAT8:
-								value = Float8GetDatum(((vops_float8*)tile)->payload[j]);
-								break;
-							  case VOPS_TEXT:
-							  {
-								  size_t elem_size = VOPS_ELEM_SIZE((char*)tile - LONGALIGN(VARHDRSZ));
-								  char* src = (char*)(tile + 1) + elem_size * j;
-								  size_t len = strnlen(src, elem_size);
-								  text* t = (text*)palloc(VARHDRSZ + len);
-								  SET_VARSIZE(t, VARHDRSZ + len);
-								  memcpy(VARDATA(t), src, len);
-								  value = PointerGetDatum(t);
-								  break;
-							  }
-							  default:
-								Assert(false);
-							}
-							fsstate->dst_values[i] = value;
-							fsstate->dst_nulls[i] = false;
-						}
-					} else { 
-						if (fsstate->attr_types[i] == FLOAT8OID	&& TupleDescAttr(fsstate->tupdesc, i)->atttypid == FLOAT4OID)
-						{
-							fsstate->dst_values[i] = Float4GetDatum((float)DatumGetFloat8(fsstate->src_values[i]));
-						} else { 
-							fsstate->dst_values[i] = fsstate->src_values[i];
-						}
-						fsstate->dst_nulls[i] = fsstate->src_nulls[i];
-					}
-				}
-				fsstate->tile_pos = j+1;
-				/*
-				 * Return the next tuple.
-				 */
-				MemoryContextSwitchTo(oldcontext);
-				tup = heap_form_tuple(fsstate->tupdesc, fsstate->dst_values, fsstate->dst_nulls);				
-#if PG_VERSION_NUM>=120000
-				ExecStoreHeapTuple(tup, slot, false);
-#else
-				ExecStoreTuple(tup, slot, InvalidBuffer, false);
-#endif
-				return slot;
-			}
-		  NextTuple:;
+		j += 1;
+	}
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * Find column of VOPS table with the same name as attribute of foreign table
+ * or with name specified by column_name option (as in deparseColumnRef).
+ * Returns -1 if there is no such column.
+ */
+static int
+vopsFdwFindVopsColumn(PgFdwScanState *fsstate, TupleDesc src_desc, int attno)
+{
+	char const* attname = NameStr(TupleDescAttr(fsstate->tupdesc, attno-1)->attname);
+	ListCell *opt;
+	int j;
+
+	foreach(opt, GetForeignColumnOptions(RelationGetRelid(fsstate->rel), attno))
+	{
+		DefElem *def = (DefElem *) lfirst(opt);
+		if (strcmp(def->defname, "column_name") == 0)
+		{
+			attname = defGetString(def);
+			break;
 		}
-		SPI_freetuple(fsstate->spi_tuple);
-		if (fsstate->portal) { 
-			SPI_freetuptable(SPI_tuptable);
+	}
+	for (j = 0; j < src_desc->natts; j++)
+	{
+		if (!TupleDescAttr(src_desc, j)->attisdropped
+			&& strcmp(NameStr(TupleDescAttr(src_desc, j)->attname), attname) == 0)
+		{
+			return j;
 		}
-		fsstate->spi_tuple = NULL;
 	}
+	return -1;
 }
 
-
 /*
- * postgresReScanForeignScan
- *		Restart the scan.
+ * Map attributes of foreign table to columns of VOPS table.
+ * If columns used by pushed down conditions have unexpected types,
+ * direct scan is disabled.
  */
 static void
-postgresReScanForeignScan(ForeignScanState *node)
+vopsFdwInitDirectTypes(PgFdwScanState *fsstate)
 {
-	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
-	Datum*      values = NULL;
-	char*       nulls = NULL;
+	TupleDesc src_desc = RelationGetDescr(fsstate->vops_rel);
+	int n_attrs = fsstate->tupdesc->natts;
+	int i, j;
+	ListCell *lc;
 	MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
-	Oid* argtypes = NULL;
-	int rc;
-
-	if (fsstate->numParams > 0) {
-		ExprContext *econtext = node->ss.ps.ps_ExprContext;
-		ForeignScan *fsplan = (ForeignScan *) node->ss.ps.plan;
-		List* param_exprs = (List *)ExecInitExpr((Expr *)fsplan->fdw_exprs, (PlanState *) node);
-		ListCell *lc;
-		int i = 0;
-
-		values = palloc(sizeof(Datum)*fsstate->numParams);
-		nulls = palloc(sizeof(bool)*fsstate->numParams);
-		argtypes = palloc(sizeof(Oid)*fsstate->numParams);
 
-		foreach(lc, param_exprs)
+	fsstate->n_src_attrs = src_desc->natts;
+	fsstate->src_attnos = palloc(sizeof(int)*n_attrs);
+	fsstate->vops_types = palloc(sizeof(vops_type)*n_attrs);
+	fsstate->attr_types = palloc(sizeof(Oid)*n_attrs);
+	for (i = 0; i < n_attrs; i++) {
+		fsstate->src_attnos[i] = -1;
+		fsstate->vops_types[i] = VOPS_LAST;
+		fsstate->attr_types[i] = InvalidOid;
+	}
+	foreach(lc, fsstate->retrieved_attrs)
+	{
+		i = lfirst_int(lc);
+		if (i > 0)
 		{
-			ExprState  *expr_state = (ExprState *) lfirst(lc);
-			bool isnull;
-			/* Evaluate the parameter expression */
-#if PG_VERSION_NUM<100000
-			ExprDoneCond isDone;
-			values[i] = ExecEvalExpr(expr_state, econtext, &isnull, &isDone);
-#else
-			values[i] = ExecEvalExpr(expr_state, econtext, &isnull);
-#endif
-			nulls[i] = (char)isnull;
-			argtypes[i] = exprType((Node*)expr_state->expr);
-			i += 1;
+			j = vopsFdwFindVopsColumn(fsstate, src_desc, i);
+			if (j >= 0)
+			{
+				fsstate->src_attnos[i-1] = j;
+				fsstate->attr_types[i-1] = TupleDescAttr(src_desc, j)->atttypid;
+				fsstate->vops_types[i-1] = vops_get_type(fsstate->attr_types[i-1]);
+			}
 		}
 	}
-	if (fsstate->rel == NULL) { /* aggregate is pushed down: do not use cusror to allow parallel query execution */
-		rc = SPI_execute_with_args(fsstate->query, fsstate->numParams, argtypes, values, nulls, true, 0);
-		if (rc != SPI_OK_SELECT) { 
-			elog(ERROR, "Failed to execute VOPS query %s: %d", fsstate->query, rc);
+#if PG_VERSION_NUM>=120000
+	if (fsstate->quals != NULL)
+	{
+		/* Columns used in conditions may be not retrieved */
+		vops_type* qual_types = palloc(sizeof(vops_type)*n_attrs);
+		fsstate->qual_attnos = palloc(sizeof(int)*n_attrs);
+		for (i = 0; i < n_attrs; i++) {
+			j = vopsFdwFindVopsColumn(fsstate, src_desc, i+1);
+			fsstate->qual_attnos[i] = j;
+			qual_types[i] = j >= 0 ? vops_get_type(TupleDescAttr(src_desc, j)->atttypid) : VOPS_LAST;
+		}
+		if (!vops_scan_check_quals(fsstate->quals, fsstate->qual_attnos, qual_types)) {
+			fsstate->direct = false;
+			fsstate->quals = NULL;
+			fsstate->src_attnos = NULL; /* will be initialized from result of VOPS query */
+			MemoryContextSwitchTo(oldcontext);
+			return;
 		}
-		fsstate->portal = NULL;
-	} else { 
-		fsstate->portal = SPI_cursor_open_with_args(NULL, fsstate->query, fsstate->numParams, argtypes, values, nulls, true, CURSOR_OPT_PARALLEL_OK);
 	}
-	fsstate->table_pos = 0;
-	fsstate->spi_tuple = NULL;
+#endif
+	fsstate->batch_size = VOPS_FDW_BATCH_SIZE;
+	fsstate->batch_values = palloc(sizeof(Datum)*fsstate->batch_size*fsstate->n_src_attrs);
+	fsstate->batch_nulls = palloc(sizeof(bool)*fsstate->batch_size*fsstate->n_src_attrs);
+	fsstate->batch_masks = palloc(sizeof(uint64)*fsstate->batch_size);
+	MemoryContextSwitchTo(oldcontext);
+}
+
+static void
+vopsFdwReceiverStartup(DestReceiver *self, int operation, TupleDesc typeinfo)
+{
+}
+
+static bool
+vopsFdwReceiveSlot(TupleTableSlot *slot, DestReceiver *self)
+{
+	PgFdwScanState *fsstate = ((VopsFdwReceiver*)self)->fsstate;
+	TupleDesc desc = slot->tts_tupleDescriptor;
+	Datum* values = &fsstate->batch_values[fsstate->batch_rows*desc->natts];
+	bool* nulls = &fsstate->batch_nulls[fsstate->batch_rows*desc->natts];
+	MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->batch_context);
+	int i;
 
+	Assert(fsstate->batch_rows < fsstate->batch_size);
+	slot_getallattrs(slot);
+	for (i = 0; i < desc->natts; i++) {
+		Form_pg_attribute attr = TupleDescAttr(desc, i);
+		nulls[i] = slot->tts_isnull[i];
+		values[i] = nulls[i] ? (Datum)0 : datumCopy(slot->tts_values[i], attr->attbyval, attr->attlen);
+	}
+	/*
+	 * WHERE clause of the query was just evaluated for this tuple.
+	 * It is not true for a join, which passes mask in separate column.
+	 */
+	fsstate->batch_masks[fsstate->batch_rows++] = fsstate->rel != NULL ? filter_mask : ~(uint64)0;
+	filter_mask = ~0;
 	MemoryContextSwitchTo(oldcontext);
+	return true;
+}
+
+static void
+vopsFdwReceiverShutdown(DestReceiver *self)
+{
+}
+
+static void
+vopsFdwReceiverDestroy(DestReceiver *self)
+{
 }
 
 /*
- * postgresEndForeignScan
- *		Finish scanning foreign table and dispose objects used for this scan
+ * Fetch next batch of tuples from cursor.
+ * Returns false if there are no more tuples.
  */
-static void
-postgresEndForeignScan(ForeignScanState *node)
+static bool
+vopsFdwFetchBatch(PgFdwScanState *fsstate)
 {
-	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	VopsFdwReceiver receiver;
+	MemoryContext oldcontext;
 
-	/* if fsstate is NULL, we are in EXPLAIN; nothing to do */
-	if (fsstate != NULL)
-	{
-		MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
+	fsstate->batch_rows = 0;
+	fsstate->batch_pos = 0;
+	if (fsstate->portal == NULL) {
+		return false; /* all tuples are already fetched by SPI_execute */
+	}
+	MemoryContextReset(fsstate->batch_context);
+	receiver.pub.receiveSlot = vopsFdwReceiveSlot;
+	receiver.pub.rStartup = vopsFdwReceiverStartup;
+	receiver.pub.rShutdown = vopsFdwReceiverShutdown;
+	receiver.pub.rDestroy = vopsFdwReceiverDestroy;
+	receiver.pub.mydest = DestNone;
+	receiver.fsstate = fsstate;
 
-		if (fsstate->portal) {
-			SPI_cursor_close(fsstate->portal);
+	oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
+	if (fsstate->batch_values == NULL) {
+		if (fsstate->src_attnos == NULL) {
+			vopsFdwInitTypes(fsstate, fsstate->portal->tupDesc);
 		}
-		SPI_finish();
-
-		MemoryContextSwitchTo(oldcontext);
+		fsstate->batch_size = VOPS_FDW_BATCH_SIZE;
+		fsstate->batch_values = palloc(sizeof(Datum)*fsstate->batch_size*fsstate->n_src_attrs);
+		fsstate->batch_nulls = palloc(sizeof(bool)*fsstate->batch_size*fsstate->n_src_attrs);
+		fsstate->batch_masks = palloc(sizeof(uint64)*fsstate->batch_size);
 	}
+	filter_mask = ~0;
+	PortalRunFetch(fsstate->portal, FETCH_FORWARD, fsstate->batch_size, &receiver.pub);
+	MemoryContextSwitchTo(oldcontext);
+
+	return fsstate->batch_rows != 0;
 }
 
 /*
- * postgresExplainForeignScan
- *		Produce extra output for EXPLAIN of a ForeignScan on a foreign table
+ * Read next batch of tuples directly from VOPS table.
+ * Returns false if there are no more tuples.
  */
-static void
-postgresExplainForeignScan(ForeignScanState *node, ExplainState *es)
+static bool
+vopsFdwScanBatch(PgFdwScanState *fsstate)
 {
-	List	   *fdw_private;
-	char	   *sql;
-
-	fdw_private = ((ForeignScan *) node->ss.ps.plan)->fdw_private;
+	TupleDesc src_desc = RelationGetDescr(fsstate->vops_rel);
+	int n_src_attrs = fsstate->n_src_attrs;
+	MemoryContext oldcontext;
+	HeapTuple tuple;
 
-	/*
-	 * Add remote query, when VERBOSE option is specified.
-	 */
-	if (es->verbose)
+	fsstate->batch_rows = 0;
+	fsstate->batch_pos = 0;
+	if (fsstate->scan_done) {
+		return false;
+	}
+	if (fsstate->scan == NULL) {
+		fsstate->scan = table_beginscan(fsstate->vops_rel, fsstate->snapshot, 0, NULL);
+	}
+	MemoryContextReset(fsstate->batch_context);
+	oldcontext = MemoryContextSwitchTo(fsstate->batch_context);
+	while (fsstate->batch_rows < fsstate->batch_size)
 	{
-		sql = strVal(list_nth(fdw_private, FdwScanPrivateSelectSql));
-		ExplainPropertyText("VOPS query", sql, es);
+		uint64 i = fsstate->batch_rows;
+		tuple = heap_getnext(fsstate->scan, ForwardScanDirection);
+		if (tuple == NULL) {
+			fsstate->scan_done = true;
+			break;
+		}
+		/* Buffer of the tuple is released when scan moves to the next page, so copy it */
+		heap_deform_tuple(heap_copytuple(tuple), src_desc,
+						  &fsstate->batch_values[i*n_src_attrs], &fsstate->batch_nulls[i*n_src_attrs]);
+		fsstate->batch_masks[i] = ~(uint64)0;
+#if PG_VERSION_NUM>=120000
+		if (fsstate->quals != NULL) {
+			fsstate->batch_masks[i] = vops_scan_eval_quals(fsstate->quals,
+														   &fsstate->batch_values[i*n_src_attrs],
+														   &fsstate->batch_nulls[i*n_src_attrs],
+														   fsstate->qual_attnos);
+			if (fsstate->batch_masks[i] == 0) {
+				/* no elements of the tile match conditions */
+				continue;
+			}
+		}
+#endif
+		fsstate->batch_rows += 1;
 	}
+	MemoryContextSwitchTo(oldcontext);
+
+	return fsstate->batch_rows != 0;
 }
 
 /*
- * estimate_path_cost_size
- *		Get cost and size estimates for a foreign scan on given foreign relation
- *		either a base relation or a join between foreign relations or an upper
- *		relation containing foreign relations.
- *
- * param_join_conds are the parameterization clauses with outer relations.
- * pathkeys specify the expected sort order if any for given path being costed.
- *
- * The function returns the cost and size estimates in p_row, p_width,
- * p_startup_cost and p_total_cost variables.
+ * Use result of SPI_execute as a batch. Aggregates are calculated by VOPS query,
+ * so each tuple produces exactly one row.
+ */
+static void
+vopsFdwLoadTuptable(PgFdwScanState *fsstate)
+{
+	uint64 i;
+	int n_src_attrs;
+	MemoryContext oldcontext;
+
+	if (fsstate->src_attnos == NULL) {
+		vopsFdwInitTypes(fsstate, SPI_tuptable->tupdesc);
+	}
+	n_src_attrs = fsstate->n_src_attrs;
+	MemoryContextReset(fsstate->batch_context);
+	oldcontext = MemoryContextSwitchTo(fsstate->batch_context);
+	fsstate->batch_size = SPI_processed;
+	fsstate->batch_values = palloc(sizeof(Datum)*Max(SPI_processed, 1)*n_src_attrs);
+	fsstate->batch_nulls = palloc(sizeof(bool)*Max(SPI_processed, 1)*n_src_attrs);
+	fsstate->batch_masks = palloc(sizeof(uint64)*Max(SPI_processed, 1));
+	for (i = 0; i < SPI_processed; i++) {
+		heap_deform_tuple(SPI_tuptable->vals[i], SPI_tuptable->tupdesc,
+						  &fsstate->batch_values[i*n_src_attrs], &fsstate->batch_nulls[i*n_src_attrs]);
+		fsstate->batch_masks[i] = (uint64)1 << (TILE_SIZE-1);
+	}
+	fsstate->batch_rows = SPI_processed;
+	fsstate->batch_pos = 0;
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * Get text datum for the j-th element of string tile, reusing buffer of the attribute
+ */
+static Datum
+vopsFdwGetText(PgFdwScanState *fsstate, int i, vops_tile_hdr* tile, int j)
+{
+	size_t elem_size = VOPS_ELEM_SIZE((char*)tile - LONGALIGN(VARHDRSZ));
+	char* src = (char*)(tile + 1) + elem_size * j;
+	size_t len = strnlen(src, elem_size);
+	text* t;
+
+	if (fsstate->text_sizes[i] < (int)(VARHDRSZ + elem_size)) {
+		fsstate->text_sizes[i] = VARHDRSZ + elem_size;
+		fsstate->texts[i] = MemoryContextAlloc(fsstate->spi_context, fsstate->text_sizes[i]);
+	}
+	t = fsstate->texts[i];
+	SET_VARSIZE(t, VARHDRSZ + len);
+	memcpy(VARDATA(t), src, len);
+	return PointerGetDatum(t);
+}
+
+/*
+ * Check that rows are returned in the order of the key of VOPS projection.
+ * Sort of VOPS tuples by first (last) element of key tile produces sorted rows
+ * only if key ranges of tiles do not overlap, which is guaranteed by
+ * populate() and refresh of projection but not by modification of VOPS table.
+ */
+static void
+vopsFdwCheckOrder(PgFdwScanState *fsstate, Datum key, bool is_null)
+{
+	Form_pg_attribute attr = TupleDescAttr(fsstate->tupdesc, fsstate->order_key);
+
+	if (fsstate->has_last_key)
+	{
+		bool overlapped;
+		if (is_null || fsstate->last_key_null)
+		{
+			/* NULLs are last in ascending order and first in descending */
+			overlapped = is_null != fsstate->last_key_null && fsstate->last_key_null != fsstate->reverse;
+		}
+		else
+		{
+			int32 cmp = DatumGetInt32(FunctionCall2(&fsstate->order_cmp, fsstate->last_key, key));
+			overlapped = fsstate->reverse ? cmp < 0 : cmp > 0;
+		}
+		if (overlapped)
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg("key ranges of tiles of VOPS table for foreign table \"%s\" overlap",
+							RelationGetRelationName(fsstate->rel)),
+					 errhint("Projection with order key should be populated and refreshed only by its refresh function.")));
+		if (!attr->attbyval && !fsstate->last_key_null)
+			pfree(DatumGetPointer(fsstate->last_key));
+	}
+	if (is_null)
+		fsstate->last_key = (Datum)0;
+	else
+	{
+		/* Iterate is called in per-tuple memory context */
+		MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
+		fsstate->last_key = datumCopy(key, attr->attbyval, attr->attlen);
+		MemoryContextSwitchTo(oldcontext);
+	}
+	fsstate->last_key_null = is_null;
+	fsstate->has_last_key = true;
+}
+
+/*
+ * postgresIterateForeignScan
+ *		Retrieve next row from the result set, or clear tuple slot to indicate
+ *		EOF.
+ *
+ * Tiles are fetched from VOPS query in batches and rows are stored in virtual
+ * slot directly from tile payloads. Positions of the tile which are not empty
+ * and satisfy filter condition are enumerated by scanning bits of the mask.
+ */
+static TupleTableSlot *
+postgresIterateForeignScan(ForeignScanState *node)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	TupleTableSlot *slot = node->ss.ss_ScanTupleSlot;
+	Datum* values = slot->tts_values;
+	bool* nulls = slot->tts_isnull;
+	Datum* src_values;
+	bool* src_nulls;
+	int i, j;
+	int n_attrs = fsstate->tupdesc->natts;
+
+	ExecClearTuple(slot);
+
+	while (fsstate->row_mask == 0) {
+		uint64 mask;
+		if (fsstate->batch_pos == fsstate->batch_rows
+			&& !(fsstate->direct ? vopsFdwScanBatch(fsstate) : vopsFdwFetchBatch(fsstate))) {
+			return slot;
+		}
+		/* skip positions which are empty in any tile */
+		mask = fsstate->batch_masks[fsstate->batch_pos];
+		src_values = &fsstate->batch_values[fsstate->batch_pos*fsstate->n_src_attrs];
+		src_nulls = &fsstate->batch_nulls[fsstate->batch_pos*fsstate->n_src_attrs];
+		for (i = 0; i < n_attrs; i++) {
+			int k = fsstate->src_attnos[i];
+			if (fsstate->vops_types[i] != VOPS_LAST && !src_nulls[k]) {
+				if (fsstate->vops_types[i] == VOPS_TEXT) {
+					/* detoast string tile once for all its rows */
+					MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->batch_context);
+					src_values[k] = PointerGetDatum(PG_DETOAST_DATUM(src_values[k]));
+					MemoryContextSwitchTo(oldcontext);
+				}
+				mask &= ~VOPS_GET_TILE(src_values[k], fsstate->vops_types[i])->empty_mask;
+			}
+		}
+		if (fsstate->mask_column >= 0) {
+			/* select elements of tiles satisfying conditions of pushed down join */
+			if (src_nulls[fsstate->mask_column]) {
+				mask = 0;
+			} else {
+				vops_bool* cond = (vops_bool*)DatumGetPointer(src_values[fsstate->mask_column]);
+				mask &= cond->payload & ~cond->hdr.null_mask & ~cond->hdr.empty_mask;
+			}
+		}
+		fsstate->row_mask = mask;
+		fsstate->batch_pos += 1;
+	}
+	if (fsstate->reverse) {
+		j = VOPS_MSB(fsstate->row_mask);
+		fsstate->row_mask &= ~((uint64)1 << j);
+	} else {
+		j = VOPS_CTZ(fsstate->row_mask);
+		fsstate->row_mask &= fsstate->row_mask - 1;
+	}
+	src_values = &fsstate->batch_values[(fsstate->batch_pos-1)*fsstate->n_src_attrs];
+	src_nulls = &fsstate->batch_nulls[(fsstate->batch_pos-1)*fsstate->n_src_attrs];
+
+	for (i = 0; i < n_attrs; i++) {
+		int k = fsstate->src_attnos[i];
+		if (k < 0) {
+			/* column is not retrieved */
+			nulls[i] = true;
+		} else if (fsstate->vops_types[i] != VOPS_LAST) {
+			vops_tile_hdr* tile = src_nulls[k] ? NULL : VOPS_GET_TILE(src_values[k], fsstate->vops_types[i]);
+			if (tile == NULL || (tile->null_mask & ((uint64)1 << j))) {
+				nulls[i] = true;
+			} else {
+				Datum value = 0;
+				switch (fsstate->vops_types[i]) {
+				  case VOPS_BOOL:
+					value = BoolGetDatum((((vops_bool*)tile)->payload >> j) & 1);
+					break;
+				  case VOPS_CHAR:
+					value = CharGetDatum(((vops_char*)tile)->payload[j]);
+					break;
+				  case VOPS_INT2:
+					value = Int16GetDatum(((vops_int2*)tile)->payload[j]);
+					break;
+				  case VOPS_INT4:
+				  case VOPS_DATE:
+					value = Int32GetDatum(((vops_int4*)tile)->payload[j]);
+					break;
+				  case VOPS_INT8:
+				  case VOPS_INTERVAL:
+				  case VOPS_TIMESTAMP:
+				  case VOPS_TIMESTAMPTZ:
+					value = Int64GetDatum(((vops_int8*)tile)->payload[j]);
+					break;
+				  case VOPS_FLOAT4:
+					value = Float4GetDatum(((vops_float4*)tile)->payload[j]);
+					break;
+				  case VOPS_FLOAT8:
+					value = Float8GetDatum(((vops_float8*)tile)->payload[j]);
+					break;
+				  case VOPS_TEXT:
+					value = vopsFdwGetText(fsstate, i, tile, j);
+					break;
+				  case VOPS_NUMERIC:
+					value = vops_numeric_get_datum(((vops_numeric*)tile)->payload[j], ((vops_numeric*)tile)->scale);
+					break;
+				  default:
+					Assert(false);
+				}
+				values[i] = value;
+				nulls[i] = false;
+			}
+		} else {
+			if (fsstate->attr_types[i] == FLOAT8OID	&& TupleDescAttr(fsstate->tupdesc, i)->atttypid == FLOAT4OID && !src_nulls[k])
+			{
+				values[i] = Float4GetDatum((float)DatumGetFloat8(src_values[k]));
+			} else {
+				values[i] = src_values[k];
+			}
+			nulls[i] = src_nulls[k];
+		}
+	}
+	if (fsstate->order_key >= 0 && fsstate->src_attnos[fsstate->order_key] >= 0)
+		vopsFdwCheckOrder(fsstate, values[fsstate->order_key], nulls[fsstate->order_key]);
+
+	return ExecStoreVirtualTuple(slot);
+}
+
+
+/*
+ * postgresReScanForeignScan
+ *		Restart the scan.
+ */
+static void
+postgresReScanForeignScan(ForeignScanState *node)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	Datum*      values = NULL;
+	char*       nulls = NULL;
+	MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
+	Oid* argtypes = NULL;
+	int rc;
+
+	fsstate->has_last_key = false;
+	if (fsstate->direct) {
+		/* Scan is started on first fetch, unless it is parallel scan initialized through DSM */
+		if (fsstate->scan) {
+			table_rescan(fsstate->scan, NULL);
+		}
+		fsstate->scan_done = false;
+		fsstate->batch_rows = 0;
+		fsstate->batch_pos = 0;
+		fsstate->row_mask = 0;
+		MemoryContextSwitchTo(oldcontext);
+		return;
+	}
+	if (fsstate->numParams > 0) {
+		ExprContext *econtext = node->ss.ps.ps_ExprContext;
+		ForeignScan *fsplan = (ForeignScan *) node->ss.ps.plan;
+		List* param_exprs = (List *)ExecInitExpr((Expr *)fsplan->fdw_exprs, (PlanState *) node);
+		ListCell *lc;
+		int i = 0;
+
+		values = palloc(sizeof(Datum)*fsstate->numParams);
+		nulls = palloc(sizeof(bool)*fsstate->numParams);
+		argtypes = palloc(sizeof(Oid)*fsstate->numParams);
+
+		foreach(lc, param_exprs)
+		{
+			ExprState  *expr_state = (ExprState *) lfirst(lc);
+			bool isnull;
+			/* Evaluate the parameter expression */
+#if PG_VERSION_NUM<100000
+			ExprDoneCond isDone;
+			values[i] = ExecEvalExpr(expr_state, econtext, &isnull, &isDone);
+#else
+			values[i] = ExecEvalExpr(expr_state, econtext, &isnull);
+#endif
+			nulls[i] = (char)isnull;
+			argtypes[i] = exprType((Node*)expr_state->expr);
+			i += 1;
+		}
+	}
+	if (fsstate->grouped) { /* aggregate is pushed down: do not use cusror to allow parallel query execution */
+		rc = SPI_execute_with_args(fsstate->query, fsstate->numParams, argtypes, values, nulls, true, 0);
+		if (rc != SPI_OK_SELECT) { 
+			elog(ERROR, "Failed to execute VOPS query %s: %d", fsstate->query, rc);
+		}
+		fsstate->portal = NULL;
+		vopsFdwLoadTuptable(fsstate);
+	} else { 
+		if (fsstate->portal) {
+			SPI_cursor_close(fsstate->portal);
+		}
+		fsstate->portal = SPI_cursor_open_with_args(NULL, fsstate->query, fsstate->numParams, argtypes, values, nulls, true, CURSOR_OPT_PARALLEL_OK);
+		fsstate->batch_rows = 0;
+		fsstate->batch_pos = 0;
+	}
+	fsstate->row_mask = 0;
+
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * postgresEndForeignScan
+ *		Finish scanning foreign table and dispose objects used for this scan
+ */
+static void
+postgresEndForeignScan(ForeignScanState *node)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+
+	/* if fsstate is NULL, we are in EXPLAIN; nothing to do */
+	if (fsstate != NULL)
+	{
+		MemoryContext oldcontext = MemoryContextSwitchTo(fsstate->spi_context);
+
+		if (fsstate->portal) {
+			SPI_cursor_close(fsstate->portal);
+		}
+		SPI_finish();
+
+		if (fsstate->scan) {
+			table_endscan(fsstate->scan);
+		}
+		if (fsstate->vops_rel) {
+			heap_close(fsstate->vops_rel, AccessShareLock);
+		}
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+}
+
+/*
+ * postgresExplainForeignScan
+ *		Produce extra output for EXPLAIN of a ForeignScan on a foreign table
+ */
+static void
+postgresExplainForeignScan(ForeignScanState *node, ExplainState *es)
+{
+	List	   *fdw_private;
+	char	   *sql;
+
+	fdw_private = ((ForeignScan *) node->ss.ps.plan)->fdw_private;
+
+	/*
+	 * Add remote query, when VERBOSE option is specified.
+	 */
+	if (es->verbose)
+	{
+		if (intVal(list_nth(fdw_private, FdwScanPrivateDirectScan)))
+		{
+			ExplainPropertyText("VOPS scan", "direct", es);
+		}
+		else
+		{
+			sql = strVal(list_nth(fdw_private, FdwScanPrivateSelectSql));
+			ExplainPropertyText("VOPS query", sql, es);
+		}
+	}
+}
+
+#if PG_VERSION_NUM>=110000
+/*
+ * postgresEstimateDSMForeignScan
+ *		Estimate size of parallel scan descriptor of VOPS table
+ */
+static Size
+postgresEstimateDSMForeignScan(ForeignScanState *node, ParallelContext *pcxt)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+
+	Assert(fsstate->direct);
+	return table_parallelscan_estimate(fsstate->vops_rel, fsstate->snapshot);
+}
+
+/*
+ * postgresInitializeDSMForeignScan
+ *		Initialize parallel scan descriptor in shared memory and start scan of VOPS table
+ */
+static void
+postgresInitializeDSMForeignScan(ForeignScanState *node, ParallelContext *pcxt, void *coordinate)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	ParallelTableScanDesc pscan = (ParallelTableScanDesc) coordinate;
+
+	table_parallelscan_initialize(fsstate->vops_rel, pscan, fsstate->snapshot);
+	fsstate->scan = table_beginscan_parallel(fsstate->vops_rel, pscan);
+}
+
+/*
+ * postgresReInitializeDSMForeignScan
+ *		Reset parallel scan descriptor before rescan
+ */
+static void
+postgresReInitializeDSMForeignScan(ForeignScanState *node, ParallelContext *pcxt, void *coordinate)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	ParallelTableScanDesc pscan = (ParallelTableScanDesc) coordinate;
+
+	table_parallelscan_reinitialize(fsstate->vops_rel, pscan);
+}
+
+/*
+ * postgresInitializeWorkerForeignScan
+ *		Attach parallel worker to the shared scan of VOPS table
+ */
+static void
+postgresInitializeWorkerForeignScan(ForeignScanState *node, shm_toc *toc, void *coordinate)
+{
+	PgFdwScanState *fsstate = (PgFdwScanState *) node->fdw_state;
+	ParallelTableScanDesc pscan = (ParallelTableScanDesc) coordinate;
+
+	fsstate->scan = table_beginscan_parallel(fsstate->vops_rel, pscan);
+}
+#endif
+
+/*
+ * Cost of expression evaluated for the whole tile by vector operators.
+ * Cost of expression calculated for one row is measured in units of
+ * cpu_operator_cost, so it gives number of operators to be applied to the tile.
+ */
+static Cost
+vops_per_tile_cost(Cost per_row_cost, double tile_operator_cost)
+{
+	return cpu_operator_cost > 0 ? per_row_cost / cpu_operator_cost * tile_operator_cost : 0;
+}
+
+/*
+ * estimate_path_cost_size
+ *		Get cost and size estimates for a foreign scan on given foreign relation
+ *		either a base relation or a join between foreign relations or an upper
+ *		relation containing foreign relations.
+ *
+ * param_join_conds are the parameterization clauses with outer relations.
+ * pathkeys specify the expected sort order if any for given path being costed.
+ *
+ * The function returns the cost and size estimates in p_row, p_width,
+ * p_startup_cost and p_total_cost variables.
  */
 static void
 estimate_path_cost_size(PlannerInfo *root,
@@ -1025,14 +1811,16 @@ estimate_path_cost_size(PlannerInfo *root,
 		/*-----
 		 * Startup cost includes:
 		 *	  1. Startup cost for underneath input * relation
-		 *	  2. Cost of performing aggregation, per cost_agg()
+		 *	  2. Cost of performing aggregation, per cost_agg(),
+		 *	     but calculated for tiles rather than for rows
+		 *	     (grouping is possible only by scalar columns)
 		 *	  3. Startup cost for PathTarget eval
 			 *-----
 			 */
 		startup_cost = ofpinfo->rel_startup_cost;
 		startup_cost += aggcosts.transCost.startup;
-		startup_cost += aggcosts.transCost.per_tuple * input_rows;
-		startup_cost += (cpu_operator_cost * numGroupCols) * input_rows;
+		startup_cost += vops_per_tile_cost(aggcosts.transCost.per_tuple, vops_tile_aggregate_cost) * ofpinfo->tiles;
+		startup_cost += (cpu_operator_cost * numGroupCols) * ofpinfo->tiles;
 		startup_cost += ptarget->cost.startup;
 
 		/*-----
@@ -1051,23 +1839,49 @@ estimate_path_cost_size(PlannerInfo *root,
 		run_cost += cpu_tuple_cost * numGroups;
 		run_cost += ptarget->cost.per_tuple * numGroups;
 	}
+	else if (foreignrel->reloptkind == RELOPT_JOINREL)
+	{
+		PgFdwRelationInfo *fpinfo_o = (PgFdwRelationInfo *) fpinfo->outerrel->fdw_private;
+		PgFdwRelationInfo *fpinfo_i = (PgFdwRelationInfo *) fpinfo->innerrel->fdw_private;
+		QualCost	join_cost;
+
+		/*
+		 * Estimate join of VOPS tables as hash join of the underlying scans,
+		 * evaluating join clauses for each joined row.
+		 */
+		cost_qual_eval(&join_cost, fpinfo->joinclauses, root);
+
+		startup_cost = fpinfo_o->rel_startup_cost + fpinfo_i->rel_startup_cost;
+		startup_cost += join_cost.startup;
+		startup_cost += cpu_operator_cost * fpinfo_i->rows;
+
+		run_cost = fpinfo_o->rel_total_cost - fpinfo_o->rel_startup_cost;
+		run_cost += fpinfo_i->rel_total_cost - fpinfo_i->rel_startup_cost;
+		run_cost += cpu_operator_cost * fpinfo_o->rows;
+		run_cost += join_cost.per_tuple * retrieved_rows;
+	}
 	else
 	{
+		QualCost	remote_cost;
+
 		/* Clamp retrieved rows estimates to at most foreignrel->tuples. */
 		retrieved_rows = Min(retrieved_rows, foreignrel->tuples);
 
 		/*
-		 * Cost as though this were a seqscan, which is pessimistic.  We
-		 * effectively imagine the local_conds are being evaluated
-		 * remotely, too.
+		 * Cost as seqscan of VOPS table: each VOPS tuple contains tiles of
+		 * TILE_SIZE rows and pushed down conditions are evaluated by vector
+		 * operators for whole tiles. Local conditions are checked for each
+		 * unnested row.
 		 */
-		startup_cost = 0;
-		run_cost = 0;
-		run_cost += seq_page_cost * foreignrel->pages;
-		
-		startup_cost += foreignrel->baserestrictcost.startup;
-		cpu_per_tuple = cpu_tuple_cost + foreignrel->baserestrictcost.per_tuple;
-		run_cost += cpu_per_tuple * foreignrel->tuples;
+		fpinfo->tiles = Max(foreignrel->tuples / TILE_SIZE, 1);
+		cost_qual_eval(&remote_cost, fpinfo->remote_conds, root);
+
+		startup_cost = foreignrel->baserestrictcost.startup;
+		run_cost = seq_page_cost * foreignrel->pages;
+
+		cpu_per_tuple = cpu_tuple_cost + vops_per_tile_cost(remote_cost.per_tuple, vops_tile_operator_cost);
+		run_cost += cpu_per_tuple * fpinfo->tiles;
+		run_cost += fpinfo->local_conds_cost.per_tuple * retrieved_rows;
 	}
 
 	total_cost = startup_cost + run_cost;
@@ -1087,7 +1901,11 @@ estimate_path_cost_size(PlannerInfo *root,
 		fpinfo->rel_total_cost = total_cost;
 	}
 
-	total_cost += cpu_tuple_cost * retrieved_rows;
+	/* Rows are produced by unnesting tiles unless aggregates are calculated by VOPS query */
+	if (foreignrel->reloptkind == RELOPT_UPPER_REL)
+		total_cost += cpu_tuple_cost * retrieved_rows;
+	else
+		total_cost += vops_unnest_row_cost * retrieved_rows;
 
 	/* Return results. */
 	*p_rows = rows;
@@ -1304,6 +2122,437 @@ foreign_grouping_ok(PlannerInfo *root, RelOptInfo *grouped_rel)
 	return true;
 }
 
+/*
+ * Check if any of the clauses references tiles of VOPS tables of the relation
+ */
+static bool
+vops_uses_tiles(PlannerInfo *root, RelOptInfo *rel, List *clauses)
+{
+	ListCell   *lc;
+
+	foreach(lc, clauses)
+	{
+		Node	   *clause = (Node *) lfirst(lc);
+		int			relid = -1;
+
+		if (IsA(clause, RestrictInfo))
+			clause = (Node *) ((RestrictInfo *) clause)->clause;
+
+		while ((relid = bms_next_member(rel->relids, relid)) >= 0)
+		{
+			PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) find_base_rel(root, relid)->fdw_private;
+			Bitmapset  *attrs = NULL;
+
+			pull_varattnos(clause, relid, &attrs);
+			if (bms_overlap(attrs, fpinfo->tile_attrs) || bms_overlap(attrs, fpinfo->rowgroup_attrs))
+				return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * Boolean operators can be applied to vops_bool only in WHERE clause,
+ * where they are replaced by VOPS with vops_bool_and/vops_bool_or/vops_bool_not.
+ */
+static bool
+vops_contains_bool_expr(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, BoolExpr))
+		return true;
+	return expression_tree_walker(node, vops_contains_bool_expr, context);
+}
+
+#if PG_VERSION_NUM<160000
+/*
+ * get_extension_schema is exported only since PostgreSQL 16
+ */
+static Oid
+get_extension_schema(Oid ext_oid)
+{
+	Oid			result = InvalidOid;
+	Relation	rel;
+	SysScanDesc scandesc;
+	HeapTuple	tuple;
+	ScanKeyData entry[1];
+
+	rel = heap_open(ExtensionRelationId, AccessShareLock);
+	ScanKeyInit(&entry[0],
+#if PG_VERSION_NUM>=120000
+				Anum_pg_extension_oid,
+#else
+				ObjectIdAttributeNumber,
+#endif
+				BTEqualStrategyNumber, F_OIDEQ,
+				ObjectIdGetDatum(ext_oid));
+	scandesc = systable_beginscan(rel, ExtensionOidIndexId, true,
+								  NULL, 1, entry);
+	tuple = systable_getnext(scandesc);
+	if (HeapTupleIsValid(tuple))
+		result = ((Form_pg_extension) GETSTRUCT(tuple))->extnamespace;
+	systable_endscan(scandesc);
+	heap_close(rel, AccessShareLock);
+
+	return result;
+}
+#endif
+
+/*
+ * Columns of vops_projections table
+ */
+#define Anum_vops_projections_projection     1
+#define Anum_vops_projections_scalar_columns 4
+#define Anum_vops_projections_key_name       5
+
+/*
+ * Get column of foreign table corresponding to the order key of VOPS projection.
+ * Projection is populated in the order of its key and incrementally refreshed
+ * only with larger keys. If projection has no scalar columns, then ranges of
+ * key tiles are not overlapped, so sorting VOPS tuples by first element of key
+ * tile produces rows sorted by key. It is not true if VOPS table was modified
+ * in some other way, so the order of rows is checked by vopsFdwCheckOrder.
+ *
+ * vops_projections is read directly rather than through SPI because this
+ * function is called for each planning of query with ORDER BY.
+ */
+static AttrNumber
+vops_get_order_key(PlannerInfo *root, RelOptInfo *baserel)
+{
+	PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) baserel->fdw_private;
+	RangeTblEntry *rte = planner_rt_fetch(baserel->relid, root);
+	Oid         ext_oid = get_extension_oid("vops", true);
+	Oid         projections_relid;
+	Relation    rel;
+	TupleDesc   tupdesc;
+	SysScanDesc scan;
+	HeapTuple   tuple;
+	char       *key_name = NULL;
+	AttrNumber  attno;
+
+	if (!OidIsValid(ext_oid))
+		return InvalidAttrNumber;
+
+	/* vops_projections is located in the schema of extension */
+	projections_relid = get_relname_relid("vops_projections", get_extension_schema(ext_oid));
+	if (!OidIsValid(projections_relid))
+		return InvalidAttrNumber;
+
+	rel = heap_open(projections_relid, AccessShareLock);
+	tupdesc = RelationGetDescr(rel);
+	scan = systable_beginscan(rel, InvalidOid, false, GetActiveSnapshot(), 0, NULL);
+	while ((tuple = systable_getnext(scan)) != NULL)
+	{
+		bool  isnull;
+		Datum projection = heap_getattr(tuple, Anum_vops_projections_projection, tupdesc, &isnull);
+		Datum key;
+
+		if (isnull)
+			continue;
+		heap_getattr(tuple, Anum_vops_projections_scalar_columns, tupdesc, &isnull);
+		if (!isnull)
+			continue;
+		key = heap_getattr(tuple, Anum_vops_projections_key_name, tupdesc, &isnull);
+		if (isnull)
+			continue;
+		/* Projection name was used as table name by create_projection */
+		if (RangeVarGetRelid(makeRangeVarFromNameList(textToQualifiedNameList(DatumGetTextPP(projection))),
+							 NoLock, true) == fpinfo->vops_relid)
+		{
+			key_name = TextDatumGetCString(key);
+			break;
+		}
+	}
+	systable_endscan(scan);
+	heap_close(rel, AccessShareLock);
+
+	if (key_name == NULL)
+		return InvalidAttrNumber;
+
+	attno = get_attnum(rte->relid, key_name);
+	if (attno == InvalidAttrNumber
+		|| !bms_is_member(attno - FirstLowInvalidHeapAttributeNumber, fpinfo->tile_attrs))
+		return InvalidAttrNumber;
+
+	return attno;
+}
+
+/*
+ * Get pathkeys of the query which can be provided by VOPS query sorting
+ * VOPS tuples by first (or last for descending order) element of key tile.
+ * Only the first query pathkey is considered and only non-collatable
+ * types sorted using default btree operator class.
+ */
+static List *
+vops_get_ordered_pathkeys(PlannerInfo *root, RelOptInfo *baserel)
+{
+	PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) baserel->fdw_private;
+	PathKey    *pathkey;
+	AttrNumber  key_attno;
+	ListCell   *lc;
+
+	if (root->query_pathkeys == NIL || fpinfo->tile_attrs == NULL)
+		return NIL;
+
+	pathkey = (PathKey *) linitial(root->query_pathkeys);
+	if (pathkey->pk_eclass->ec_has_volatile
+		|| OidIsValid(pathkey->pk_eclass->ec_collation)
+		|| pathkey->pk_nulls_first != VOPS_PATHKEY_DESC(pathkey))
+		return NIL;
+
+	key_attno = vops_get_order_key(root, baserel);
+	if (key_attno == InvalidAttrNumber)
+		return NIL;
+	fpinfo->order_key = key_attno;
+
+	foreach(lc, pathkey->pk_eclass->ec_members)
+	{
+		Expr *expr = ((EquivalenceMember *) lfirst(lc))->em_expr;
+
+		while (IsA(expr, RelabelType))
+			expr = ((RelabelType *) expr)->arg;
+
+		if (IsA(expr, Var)
+			&& ((Var *) expr)->varno == baserel->relid
+			&& ((Var *) expr)->varlevelsup == 0
+			&& ((Var *) expr)->varattno == key_attno)
+		{
+			Oid opclass = GetDefaultOpClass(((Var *) expr)->vartype, BTREE_AM_OID);
+			if (OidIsValid(opclass) && get_opclass_family(opclass) == pathkey->pk_opfamily)
+				return list_make1(pathkey);
+			break;
+		}
+	}
+	return NIL;
+}
+
+/*
+ * Add conditions of the joined relation to the join.
+ *
+ * Pushed down conditions are placed in WHERE clause and select only VOPS
+ * tuples having some matching elements. Mask of these elements is passed in
+ * separate column. Conditions which can not be calculated as vops_bool outside
+ * WHERE clause are also checked locally for each unnested row, as well as
+ * local conditions of the joined relation (it is possible for inner join).
+ */
+static bool
+vops_add_joined_rel_conds(PlannerInfo *root, PgFdwRelationInfo *fpinfo, RelOptInfo *rel)
+{
+	PgFdwRelationInfo *rel_fpinfo = (PgFdwRelationInfo *) rel->fdw_private;
+	ListCell   *lc;
+
+	fpinfo->remote_conds = list_concat(fpinfo->remote_conds, list_copy(rel_fpinfo->remote_conds));
+
+	if (rel->reloptkind == RELOPT_JOINREL)
+	{
+		fpinfo->local_conds = list_concat(fpinfo->local_conds, list_copy(rel_fpinfo->local_conds));
+		fpinfo->mask_conds = list_concat(fpinfo->mask_conds, list_copy(rel_fpinfo->mask_conds));
+		return true;
+	}
+	foreach(lc, rel_fpinfo->local_conds)
+	{
+		RestrictInfo *rinfo = castNode(RestrictInfo, lfirst(lc));
+
+		if (rinfo->pseudoconstant)
+			return false;
+		fpinfo->local_conds = lappend(fpinfo->local_conds, rinfo->clause);
+	}
+	foreach(lc, rel_fpinfo->remote_conds)
+	{
+		RestrictInfo *rinfo = castNode(RestrictInfo, lfirst(lc));
+
+		if (rinfo->pseudoconstant)
+			return false;
+		if (!vops_uses_tiles(root, rel, list_make1(rinfo)))
+			continue;
+		if (vops_contains_bool_expr((Node *) rinfo->clause, NULL))
+			fpinfo->local_conds = lappend(fpinfo->local_conds, rinfo->clause);
+		else
+			fpinfo->mask_conds = lappend(fpinfo->mask_conds, rinfo);
+	}
+	return true;
+}
+
+/*
+ * Assess whether the join between inner and outer relations can be pushed down
+ * to VOPS query. Rows of the join are produced by unnesting tiles, so tiles
+ * can be used only for one of the joined relations (usually fact table), while
+ * other relations (dimension tables) should have no tiles at all.
+ * Join clauses can refer only scalar columns.
+ */
+static bool
+foreign_join_ok(PlannerInfo *root, RelOptInfo *joinrel, JoinType jointype,
+				RelOptInfo *outerrel, RelOptInfo *innerrel,
+				JoinPathExtraData *extra)
+{
+	PgFdwRelationInfo *fpinfo = (PgFdwRelationInfo *) joinrel->fdw_private;
+	PgFdwRelationInfo *fpinfo_o = (PgFdwRelationInfo *) outerrel->fdw_private;
+	PgFdwRelationInfo *fpinfo_i = (PgFdwRelationInfo *) innerrel->fdw_private;
+	ListCell   *lc;
+	int			relid;
+
+	/* Only inner joins are supported */
+	if (jointype != JOIN_INNER)
+		return false;
+
+	/* Both relations should be safe to push down */
+	if (!fpinfo_o || !fpinfo_o->pushdown_safe ||
+		!fpinfo_i || !fpinfo_i->pushdown_safe)
+		return false;
+
+	fpinfo->tile_relid = fpinfo_o->tile_relid != 0 ? fpinfo_o->tile_relid : fpinfo_i->tile_relid;
+	if (fpinfo->tile_relid == 0)
+		return false;
+
+	relid = -1;
+	while ((relid = bms_next_member(joinrel->relids, relid)) >= 0)
+	{
+		PgFdwRelationInfo *rel_fpinfo = (PgFdwRelationInfo *) find_base_rel(root, relid)->fdw_private;
+
+		if ((Index) relid != fpinfo->tile_relid
+			&& (rel_fpinfo->tile_attrs != NULL || rel_fpinfo->rowgroup_name != NULL))
+			return false;
+	}
+
+	/*
+	 * Separate join clauses into those which can be pushed down and which
+	 * should be evaluated locally. Pseudoconstant clauses can not be
+	 * evaluated by foreign join scan.
+	 */
+	foreach(lc, extra->restrictlist)
+	{
+		RestrictInfo *rinfo = castNode(RestrictInfo, lfirst(lc));
+
+		if (rinfo->pseudoconstant)
+			return false;
+
+		if (vops_is_foreign_expr(root, joinrel, rinfo->clause)
+			&& !vops_uses_tiles(root, joinrel, list_make1(rinfo)))
+			fpinfo->joinclauses = lappend(fpinfo->joinclauses, rinfo);
+		else
+			fpinfo->local_conds = lappend(fpinfo->local_conds, rinfo->clause);
+	}
+
+	if (!vops_add_joined_rel_conds(root, fpinfo, outerrel) ||
+		!vops_add_joined_rel_conds(root, fpinfo, innerrel))
+		return false;
+
+	fpinfo->outerrel = outerrel;
+	fpinfo->innerrel = innerrel;
+	fpinfo->table = fpinfo_o->table;
+	fpinfo->server = fpinfo_o->server;
+
+	/*
+	 * Set the string describing this join relation to be used in EXPLAIN
+	 * output of corresponding ForeignScan.
+	 */
+	fpinfo->relation_name = makeStringInfo();
+	appendStringInfo(fpinfo->relation_name, "(%s) INNER JOIN (%s)",
+					 fpinfo_o->relation_name->data,
+					 fpinfo_i->relation_name->data);
+
+	fpinfo->pushdown_safe = true;
+	return true;
+}
+
+/*
+ * postgresGetForeignJoinPaths
+ *		Add possible ForeignPath to joinrel, if join is safe to push down.
+ */
+static void
+postgresGetForeignJoinPaths(PlannerInfo *root,
+							RelOptInfo *joinrel,
+							RelOptInfo *outerrel,
+							RelOptInfo *innerrel,
+							JoinType jointype,
+							JoinPathExtraData *extra)
+{
+	PgFdwRelationInfo *fpinfo;
+	ForeignPath *joinpath;
+	double		rows;
+	int			width;
+	Cost		startup_cost;
+	Cost		total_cost;
+
+	/*
+	 * Skip if this join combination has been considered already.
+	 */
+	if (joinrel->fdw_private)
+		return;
+
+	/*
+	 * Row locking and lateral references are not supported by pushed down join.
+	 */
+	if (root->rowMarks || joinrel->lateral_relids)
+		return;
+
+	/*
+	 * Create unfinished PgFdwRelationInfo entry which is used to indicate
+	 * that the join relation is already considered, so that we won't waste
+	 * time in judging safety of join pushdown and adding the same paths again
+	 * if found safe.
+	 */
+	fpinfo = (PgFdwRelationInfo *) palloc0(sizeof(PgFdwRelationInfo));
+	fpinfo->pushdown_safe = false;
+	joinrel->fdw_private = fpinfo;
+
+	if (!foreign_join_ok(root, joinrel, jointype, outerrel, innerrel, extra))
+		return;
+
+	/*
+	 * Compute the selectivity and cost of the local_conds, so we don't have
+	 * to do it over again for each path.
+	 */
+	fpinfo->local_conds_sel = clauselist_selectivity(root,
+													 fpinfo->local_conds,
+													 0,
+													 JOIN_INNER,
+													 NULL);
+	cost_qual_eval(&fpinfo->local_conds_cost, fpinfo->local_conds, root);
+
+	fpinfo->rel_startup_cost = -1;
+	fpinfo->rel_total_cost = -1;
+
+	/* Estimate costs for bare join relation */
+	estimate_path_cost_size(root, joinrel, NIL, NIL,
+							&rows, &width, &startup_cost, &total_cost);
+
+	fpinfo->rows = rows;
+	fpinfo->width = width;
+	fpinfo->startup_cost = startup_cost;
+	fpinfo->total_cost = total_cost;
+
+	/* Create a new join path and add it to the joinrel */
+#if PG_VERSION_NUM>=120000
+	joinpath = create_foreign_join_path(root,
+										joinrel,
+										NULL,	/* default pathtarget */
+										rows,
+										startup_cost,
+										total_cost,
+										NIL,	/* no pathkeys */
+										joinrel->lateral_relids,
+										NULL,	/* no extra plan */
+#if PG_VERSION_NUM>=170000
+										NIL,	/* no fdw_restrictinfo list */
+#endif
+										NIL);	/* no fdw_private */
+#else
+	joinpath = create_foreignscan_path(root,
+									   joinrel,
+									   NULL,	/* default pathtarget */
+									   rows,
+									   startup_cost,
+									   total_cost,
+									   NIL,		/* no pathkeys */
+									   joinrel->lateral_relids,
+									   NULL,	/* no extra plan */
+									   NIL);	/* no fdw_private */
+#endif
+	add_path(joinrel, (Path *) joinpath);
+}
+
 /*
  * postgresGetForeignUpperPaths
  *		Add paths for post-join operations like aggregation, grouping etc. if
@@ -1333,6 +2582,16 @@ postgresGetForeignUpperPaths(PlannerInfo *root, UpperRelationKind stage,
 	if (stage != UPPERREL_GROUP_AGG || output_rel->fdw_private)
 		return;
 
+	/*
+	 * VOPS aggregates use filter mask set by WHERE clause for the last
+	 * evaluated tuple, which is not necessarily the tuple produced by join.
+	 * So aggregates are not pushed down through joins.
+	 * TODO: pass mask of join conditions (see deparseSelectSql) to the
+	 * aggregates of VOPS query to push down aggregation over joins.
+	 */
+	if (input_rel->reloptkind == RELOPT_JOINREL)
+		return;
+
 	fpinfo = (PgFdwRelationInfo *) palloc0(sizeof(PgFdwRelationInfo));
 	fpinfo->pushdown_safe = false;
 	output_rel->fdw_private = fpinfo;
@@ -1457,7 +2716,7 @@ postgresAnalyzeForeignTable(Relation relation,
 	*func = postgresAcquireSampleRowsFunc;
 
 	table = GetForeignTable(RelationGetRelid(relation));
-	vops_rel = open_vops_relation(table);
+	vops_rel = open_vops_relation(table, RowExclusiveLock);
 	estimate_rel_size(vops_rel, NULL, totalpages, &tuples, &allvisfrac);
     heap_close(vops_rel, RowExclusiveLock);
 
@@ -1465,7 +2724,10 @@ postgresAnalyzeForeignTable(Relation relation,
 }
 
 /*
- * Acquire a random sample of rows from VOPS table
+ * Acquire a random sample of rows from VOPS table.
+ * Like ANALYZE of normal tables, it reads random subset of blocks of VOPS
+ * table (using TABLESAMPLE SYSTEM) and performs reservoir sampling of rows
+ * unnested from the tiles of these blocks.
  */
 static int
 postgresAcquireSampleRowsFunc(Relation relation, int elevel,
@@ -1476,12 +2738,28 @@ postgresAcquireSampleRowsFunc(Relation relation, int elevel,
 	TupleDesc tupdesc = RelationGetDescr(relation);
 	StringInfoData sql;
 	StringInfoData record;
-	double samplerows;
+	double samplerows = 0;
+	double rowstoskip = -1;    /* -1 means not set yet */
+	double sample_fraction;
+	ReservoirStateData rstate; /* state for reservoir sampling */
 	Portal portal;
+	Relation vops_rel;
+	BlockNumber totalblocks;
+	int numrows = 0;
 	int i;
 	bool first = true;
 	char*colname;
 
+	vops_rel = open_vops_relation(GetForeignTable(RelationGetRelid(relation)), AccessShareLock);
+	totalblocks = RelationGetNumberOfBlocks(vops_rel);
+	heap_close(vops_rel, AccessShareLock);
+
+	/*
+	 * Each block of VOPS table contains tiles for many rows, so sampling
+	 * targrows blocks (as ANALYZE does for normal tables) is more than enough.
+	 */
+	sample_fraction = totalblocks > (BlockNumber)targrows ? (double)targrows / totalblocks : 1.0;
+
     SPI_connect();
 	
 	initStringInfo(&sql);
@@ -1508,50 +2786,50 @@ postgresAcquireSampleRowsFunc(Relation relation, int elevel,
 	}
 	appendStringInfoString(&sql, " FROM ");
 	vopsDeparseRelation(&sql, relation);
-	appendStringInfo(&sql, " t,vops_unnest(t) r(%s)", record.data);
+	appendStringInfoString(&sql, " t");
+	if (sample_fraction < 1.0)
+		appendStringInfo(&sql, " TABLESAMPLE SYSTEM (%g)", sample_fraction * 100);
+	appendStringInfo(&sql, ",vops_unnest(t) r(%s)", record.data);
 	
 	portal = SPI_cursor_open_with_args(NULL, sql.data, 0, NULL, NULL, NULL, true, 0);
 
-	/* First targrows rows are always included into the sample */
-	SPI_cursor_fetch(portal, true, targrows);
-	for (i = 0; i < SPI_processed; i++)
-	{
-		rows[i] = SPI_copytuple(SPI_tuptable->vals[i]);
-	}
-	samplerows = i;
-
-	if (i == targrows) 
-	{ 
-		ReservoirStateData rstate; /* state for reservoir sampling */
-		double rowstoskip = -1;    /* -1 means not set yet */
-
-		reservoir_init_selection_state(&rstate, targrows);
+	reservoir_init_selection_state(&rstate, targrows);
 
-		while (true) 
-		{ 
-			SPI_freetuptable(SPI_tuptable);
-			SPI_cursor_fetch(portal, true, 1);
-			if (!SPI_processed) { 
-				break;
-			}
-			samplerows += 1;
-			if (rowstoskip < 0) {
-				rowstoskip = reservoir_get_next_S(&rstate, samplerows, targrows);
+	while (true)
+	{
+		SPI_cursor_fetch(portal, true, VOPS_FDW_BATCH_SIZE*TILE_SIZE);
+		if (!SPI_processed) {
+			break;
+		}
+		for (i = 0; i < SPI_processed; i++)
+		{
+			/* First targrows rows are always included into the sample */
+			if (numrows < targrows)
+			{
+				rows[numrows++] = SPI_copytuple(SPI_tuptable->vals[i]);
 			}
-			if (rowstoskip <= 0)
+			else
 			{
-				/* Choose a random reservoir element to replace. */
+				if (rowstoskip < 0) {
+					rowstoskip = reservoir_get_next_S(&rstate, samplerows, targrows);
+				}
+				if (rowstoskip <= 0)
+				{
+					/* Choose a random reservoir element to replace. */
 #if PG_VERSION_NUM >= 150000
-				int pos = (int) (targrows * sampler_random_fract(&rstate.randstate));
+					int pos = (int) (targrows * sampler_random_fract(&rstate.randstate));
 #else
-				int pos = (int) (targrows * sampler_random_fract(rstate.randstate));
+					int pos = (int) (targrows * sampler_random_fract(rstate.randstate));
 #endif
-				Assert(pos >= 0 && pos < targrows);
-				SPI_freetuple(rows[pos]);
-				rows[pos] = SPI_copytuple(SPI_tuptable->vals[0]);
+					Assert(pos >= 0 && pos < targrows);
+					SPI_freetuple(rows[pos]);
+					rows[pos] = SPI_copytuple(SPI_tuptable->vals[i]);
+				}
+				rowstoskip -= 1;
 			}
-			rowstoskip -= 1;
+			samplerows += 1;
 		}
+		SPI_freetuptable(SPI_tuptable);
 	}
 	SPI_cursor_close(portal);
 	SPI_finish();
@@ -1559,8 +2837,14 @@ postgresAcquireSampleRowsFunc(Relation relation, int elevel,
 	/* We assume that we have no dead tuple. */
 	*totaldeadrows = 0.0;
 
-	/* We've retrieved all living tuples from foreign server. */
-	*totalrows = samplerows;
+	/* Extrapolate number of rows in sampled blocks to the whole table */
+	*totalrows = floor(samplerows / sample_fraction + 0.5);
+
+	ereport(elevel,
+			(errmsg("\"%s\": sampled %.2f%% of %u pages of VOPS table, containing %.0f rows; %d rows in sample, %.0f estimated total rows",
+					RelationGetRelationName(relation),
+					sample_fraction * 100, totalblocks,
+					samplerows, numrows, *totalrows)));
 
-	return i;
+	return numrows;
 }
@@ -21,6 +21,7 @@
 #include "nodes/relation.h"
 #endif
 #include "utils/relcache.h"
+#include "access/stratnum.h"
 
 #include "libpq-fe.h"
 
@@ -61,6 +62,27 @@ typedef struct PgFdwRelationInfo
 	/* Bitmap of VOPS tile attributes (attributes represented by tiles in VOPS projection) */
 	Bitmapset  *tile_attrs;
 
+	/* Bitmap of attributes extracted from row group column of VOPS projection */
+	Bitmapset  *rowgroup_attrs;
+
+	/* Name of row group column of VOPS projection (if any) */
+	char	   *rowgroup_name;
+
+	/* OID of VOPS table */
+	Oid			vops_relid;
+
+	/* Number of blocks of VOPS table */
+	BlockNumber	vops_pages;
+
+	/* Column which is the order key of VOPS projection (0 if none) */
+	AttrNumber	order_key;
+
+	/* Maximal number of VOPS tuples to be fetched (0 if not limited) */
+	double		limit_tuples;
+
+	/* Estimated number of scanned VOPS tuples (tiles) */
+	double		tiles;
+
 	/* Cost and selectivity of local_conds. */
 	QualCost	local_conds_cost;
 	Selectivity local_conds_sel;
@@ -88,6 +110,23 @@ typedef struct PgFdwRelationInfo
 	/* Grouping information */
 	RelOptInfo *upperrel;
 	List	   *grouped_tlist;
+
+	/* Join information */
+	RelOptInfo *outerrel;
+	RelOptInfo *innerrel;
+	List	   *joinclauses;
+
+	/*
+	 * Base relation whose tiles are fetched by the scan (0 if none). Rows of
+	 * a join are produced from tiles of at most one of the joined relations.
+	 */
+	Index		tile_relid;
+
+	/*
+	 * Conditions on tiles of tile_relid, which are passed for a join as an
+	 * extra vops_bool column used as mask of selected tile elements.
+	 */
+	List	   *mask_conds;
 } PgFdwRelationInfo;
 
 extern void vopsClassifyConditions(PlannerInfo *root,
@@ -95,6 +134,14 @@ extern void vopsClassifyConditions(PlannerInfo *root,
 							   List *input_conds,
 							   List **remote_conds,
 							   List **local_conds);
+
+/* Sort order of path key: descending order of VOPS tuples is used for DESC NULLS FIRST */
+#if PG_VERSION_NUM>=180000
+#define VOPS_PATHKEY_DESC(pk) ((pk)->pk_cmptype == COMPARE_GT)
+#else
+#define VOPS_PATHKEY_DESC(pk) ((pk)->pk_strategy == BTGreaterStrategyNumber)
+#endif
+
 extern bool vops_is_foreign_expr(PlannerInfo *root,
 							RelOptInfo *baserel,
 							Expr *expr);
@@ -0,0 +1,435 @@
+/*
+ * vops_lookup.c
+ *
+ * Vector lookup in scalar dimension table.
+ *
+ * Star-schema queries join fact table with small dimension tables.
+ * Join with VOPS table requires unnesting of tiles, after which vector
+ * aggregates can not be used. vops_lookup() performs such join without
+ * unnesting: it builds hash table of the dimension once per query (hash
+ * table is cached in fn_extra) and probes it with all keys of the tile,
+ * producing tile of values of dimension attribute. Elements for which there is
+ * no matching dimension record are NULL, so if attribute is declared NOT NULL,
+ * then is_not_null() of the result gives match mask for inner join:
+ *
+ *   select sum(l_extendedprice*(1-l_discount)) from vops_lineitem
+ *   where filter(is_not_null(vops_lookup('orders', 'o_orderkey', l_orderkey, 'o_orderdate', null::vops_date)));
+ *
+ * For nullable attribute NULL element can also mean matched record with NULL
+ * value: vops_in() with array of dimension keys should be used to get match mask.
+ *
+ * Semi-join with subquery is performed by vops_in(), which tests keys of the
+ * tile for membership in hash set built from array of subquery results:
+ *
+ *   where filter(vops_in(l_orderkey, array(select o_orderkey from orders where o_orderstatus='F')))
+ *
+ * Projection substitution rewrites IN subqueries on vector columns in this way.
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "catalog/pg_type.h"
+#include "executor/spi.h"
+#include "nodes/primnodes.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+#include "utils/hsearch.h"
+#include "utils/lsyscache.h"
+#include "utils/memutils.h"
+#include "vops.h"
+
+typedef struct
+{
+	int64		key;
+	vops_value	value;
+	bool		isnull;
+} vops_lookup_entry;
+
+/*
+ * Hash table of dimension cached in fn_extra
+ */
+typedef struct
+{
+	Oid			relid;
+	char	   *key_column;
+	char	   *attr_column;
+	HTAB	   *hash;
+} vops_lookup_cache;
+
+static int64
+vops_lookup_get_key(Datum val, Oid type)
+{
+	switch (type)
+	{
+		case INT2OID:
+			return DatumGetInt16(val);
+		case INT4OID:
+			return DatumGetInt32(val);
+		default:
+			return DatumGetInt64(val);
+	}
+}
+
+/*
+ * Widen elements of integer tile to int64
+ */
+static void
+vops_lookup_tile_keys(vops_tile_hdr *tile, vops_type tid, int64 *keys)
+{
+	int			i;
+
+	switch (tid)
+	{
+		case VOPS_INT2:
+			for (i = 0; i < TILE_SIZE; i++)
+				keys[i] = ((vops_int2 *) tile)->payload[i];
+			break;
+		case VOPS_INT4:
+			for (i = 0; i < TILE_SIZE; i++)
+				keys[i] = ((vops_int4 *) tile)->payload[i];
+			break;
+		case VOPS_INT8:
+			for (i = 0; i < TILE_SIZE; i++)
+				keys[i] = ((vops_int8 *) tile)->payload[i];
+			break;
+		default:
+			elog(ERROR, "Lookup key should be vops_int2, vops_int4 or vops_int8");
+	}
+}
+
+/*
+ * Load dimension table into hash table
+ */
+static HTAB *
+vops_lookup_build(Oid relid, char const *key_column, char const *attr_column,
+				  vops_type tid, MemoryContext mcxt)
+{
+	HTAB	   *hash;
+	HASHCTL		ctl;
+	char	   *sql;
+	TupleDesc	spi_tupdesc;
+	Oid			key_type;
+	Oid			attr_type;
+	uint64		i;
+	int			rc;
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "SPI_connect failed");
+	sql = psprintf("select %s,%s from %s.%s",
+				   quote_identifier(key_column), quote_identifier(attr_column),
+				   quote_identifier(get_namespace_name(get_rel_namespace(relid))),
+				   quote_identifier(get_rel_name(relid)));
+	rc = SPI_execute(sql, true, 0);
+	if (rc != SPI_OK_SELECT)
+	{
+		elog(ERROR, "Select failed with status %d", rc);
+	}
+	spi_tupdesc = SPI_tuptable->tupdesc;
+	key_type = SPI_gettypeid(spi_tupdesc, 1);
+	attr_type = SPI_gettypeid(spi_tupdesc, 2);
+	if (key_type != INT2OID && key_type != INT4OID && key_type != INT8OID)
+		elog(ERROR, "Key column %s of dimension table %s should have integer type",
+			 key_column, get_rel_name(relid));
+	if (attr_type != vops_get_elem_type(tid))
+		elog(ERROR, "Column %s of dimension table %s has type %s, but %s is requested",
+			 attr_column, get_rel_name(relid), format_type_be(attr_type),
+			 format_type_be(vops_get_elem_type(tid)));
+
+	memset(&ctl, 0, sizeof(ctl));
+	ctl.keysize = sizeof(int64);
+	ctl.entrysize = sizeof(vops_lookup_entry);
+	ctl.hcxt = mcxt;
+	hash = hash_create("vops_lookup", Max(SPI_processed, 64), &ctl,
+					   HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+
+	for (i = 0; i < SPI_processed; i++)
+	{
+		HeapTuple	spi_tuple = SPI_tuptable->vals[i];
+		vops_lookup_entry *entry;
+		bool		is_null;
+		bool		found;
+		Datum		val = SPI_getbinval(spi_tuple, spi_tupdesc, 1, &is_null);
+		int64		key;
+
+		if (is_null)
+			continue;			/* NULL key never matches */
+
+		key = vops_lookup_get_key(val, key_type);
+		entry = (vops_lookup_entry *) hash_search(hash, &key, HASH_ENTER, &found);
+		if (found)
+			elog(ERROR, "Duplicate key " INT64_FORMAT " in column %s of dimension table %s",
+				 key, key_column, get_rel_name(relid));
+
+		val = SPI_getbinval(spi_tuple, spi_tupdesc, 2, &entry->isnull);
+		if (entry->isnull)
+			continue;
+		switch (tid)
+		{
+			case VOPS_CHAR:
+				entry->value.i8 = DatumGetChar(val);
+				break;
+			case VOPS_INT2:
+				entry->value.i8 = DatumGetInt16(val);
+				break;
+			case VOPS_INT4:
+			case VOPS_DATE:
+				entry->value.i8 = DatumGetInt32(val);
+				break;
+			case VOPS_INT8:
+			case VOPS_TIMESTAMP:
+			case VOPS_TIMESTAMPTZ:
+				entry->value.i8 = DatumGetInt64(val);
+				break;
+			case VOPS_FLOAT4:
+				entry->value.f8 = DatumGetFloat4(val);
+				break;
+			case VOPS_FLOAT8:
+				entry->value.f8 = DatumGetFloat8(val);
+				break;
+			default:
+				Assert(false);
+		}
+	}
+	SPI_finish();
+	return hash;
+}
+
+/*
+ * vops_lookup(dimension regclass, key_column text, key vops_intN, attr_column text, result anyelement)
+ * Type of the result is determined by the type of last (template) argument
+ * which should be tile type corresponding to the type of dimension attribute.
+ */
+PG_FUNCTION_INFO_V1(vops_lookup);
+Datum
+vops_lookup(PG_FUNCTION_ARGS)
+{
+	Oid			relid = PG_GETARG_OID(0);
+	char	   *key_column;
+	char	   *attr_column;
+	vops_type	key_tid = vops_get_type(get_fn_expr_argtype(fcinfo->flinfo, 2));
+	Oid			result_type = get_fn_expr_argtype(fcinfo->flinfo, 4);
+	vops_type	tid = vops_get_type(result_type);
+	vops_lookup_cache *cache = (vops_lookup_cache *) fcinfo->flinfo->fn_extra;
+	vops_tile_hdr *key_tile;
+	vops_tile_hdr *result;
+	uint64		null_mask;
+	int64		keys[TILE_SIZE];
+	int			i;
+
+	if (PG_ARGISNULL(0) || PG_ARGISNULL(1) || PG_ARGISNULL(2) || PG_ARGISNULL(3))
+		PG_RETURN_NULL();
+
+	if (tid < VOPS_CHAR || tid > VOPS_FLOAT8)
+		elog(ERROR, "Lookup of %s values is not supported", format_type_be(result_type));
+
+	key_column = text_to_cstring(PG_GETARG_TEXT_PP(1));
+	attr_column = text_to_cstring(PG_GETARG_TEXT_PP(3));
+	if (cache == NULL || cache->relid != relid
+		|| strcmp(cache->key_column, key_column) != 0
+		|| strcmp(cache->attr_column, attr_column) != 0)
+	{
+		MemoryContext mcxt = fcinfo->flinfo->fn_mcxt;
+
+		if (cache == NULL)
+			cache = (vops_lookup_cache *) MemoryContextAllocZero(mcxt, sizeof(vops_lookup_cache));
+		else
+		{
+			hash_destroy(cache->hash);
+			pfree(cache->key_column);
+			pfree(cache->attr_column);
+		}
+		cache->hash = vops_lookup_build(relid, key_column, attr_column, tid, mcxt);
+		cache->relid = relid;
+		cache->key_column = MemoryContextStrdup(mcxt, key_column);
+		cache->attr_column = MemoryContextStrdup(mcxt, attr_column);
+		fcinfo->flinfo->fn_extra = cache;
+	}
+
+	key_tile = (vops_tile_hdr *) PG_GETARG_POINTER(2);
+	vops_lookup_tile_keys(key_tile, key_tid, keys);
+
+	result = (vops_tile_hdr *) palloc(get_typlen(result_type));
+	null_mask = key_tile->null_mask;
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		vops_lookup_entry *entry;
+		vops_value	val;
+
+		if ((null_mask | key_tile->empty_mask) & ((uint64) 1 << i))
+			entry = NULL;
+		else
+			entry = (vops_lookup_entry *) hash_search(cache->hash, &keys[i], HASH_FIND, NULL);
+		if (entry == NULL || entry->isnull)
+		{
+			null_mask |= (uint64) 1 << i;
+			val.i8 = 0;
+		}
+		else
+			val = entry->value;
+
+		switch (tid)
+		{
+			case VOPS_CHAR:
+				((vops_char *) result)->payload[i] = (char) val.i8;
+				break;
+			case VOPS_INT2:
+				((vops_int2 *) result)->payload[i] = (int16) val.i8;
+				break;
+			case VOPS_INT4:
+			case VOPS_DATE:
+				((vops_int4 *) result)->payload[i] = (int32) val.i8;
+				break;
+			case VOPS_INT8:
+			case VOPS_TIMESTAMP:
+			case VOPS_TIMESTAMPTZ:
+				((vops_int8 *) result)->payload[i] = val.i8;
+				break;
+			case VOPS_FLOAT4:
+				((vops_float4 *) result)->payload[i] = (float4) val.f8;
+				break;
+			case VOPS_FLOAT8:
+				((vops_float8 *) result)->payload[i] = val.f8;
+				break;
+			default:
+				Assert(false);
+		}
+	}
+	result->null_mask = null_mask;
+	result->empty_mask = key_tile->empty_mask;
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * Hash set of semi-join keys cached in fn_extra
+ */
+typedef struct
+{
+	bool		fixed;			/* array is the same for all calls during query execution */
+	Pointer		datum;			/* array datum from which hash set was built */
+	Size		size;
+	ArrayType  *array;			/* copy of array (only if not fixed) */
+	int64		min;			/* range of keys: to skip hash lookups */
+	int64		max;
+	HTAB	   *hash;
+} vops_in_cache;
+
+/*
+ * Array is not changed during query execution if it is a constant, query parameter or
+ * result of uncorrelated ARRAY(subquery) calculated once by executor (initplan parameter).
+ * fn_extra is allocated in per-query memory, so hash set is built once per execution in this case.
+ */
+static bool
+vops_in_array_is_fixed(FmgrInfo *flinfo)
+{
+	Node	   *arg;
+
+	if (get_fn_expr_arg_stable(flinfo, 1))
+		return true;
+	if (flinfo->fn_expr == NULL || !IsA(flinfo->fn_expr, FuncExpr))
+		return false;
+	arg = (Node *) lsecond(((FuncExpr *) flinfo->fn_expr)->args);
+	return IsA(arg, Param) && ((Param *) arg)->paramkind == PARAM_EXEC;
+}
+
+/*
+ * vops_in(key vops_intN, keys anyarray) returns vops_bool
+ * Array is usually produced by uncorrelated ARRAY(subquery) which is
+ * calculated once by executor, so the same datum is passed to all calls
+ * and checking its address and size is enough to reuse the hash set.
+ * Otherwise (correlated subquery, column of the table) memory of the previous
+ * array can be reused for the new one, so array is compared with the cached copy.
+ * NULL elements of array are ignored.
+ */
+PG_FUNCTION_INFO_V1(vops_in);
+Datum
+vops_in(PG_FUNCTION_ARGS)
+{
+	vops_tile_hdr *key_tile = (vops_tile_hdr *) PG_GETARG_POINTER(0);
+	vops_type	key_tid = vops_get_type(get_fn_expr_argtype(fcinfo->flinfo, 0));
+	Pointer		datum = PG_GETARG_POINTER(1);
+	Size		size = VARSIZE_ANY(datum);
+	vops_in_cache *cache = (vops_in_cache *) fcinfo->flinfo->fn_extra;
+	vops_bool  *result = (vops_bool *) palloc(sizeof(vops_bool));
+	uint64		payload = 0;
+	uint64		mask;
+	int64		keys[TILE_SIZE];
+	int			i;
+
+	if (cache == NULL || cache->datum != datum || cache->size != size
+		|| (!cache->fixed && memcmp(cache->array, datum, size) != 0))
+	{
+		ArrayType  *arr = PG_GETARG_ARRAYTYPE_P(1);
+		Oid			elem_type = ARR_ELEMTYPE(arr);
+		MemoryContext mcxt = fcinfo->flinfo->fn_mcxt;
+		HASHCTL		ctl;
+		Datum	   *elems;
+		bool	   *nulls;
+		int16		elmlen;
+		bool		elmbyval;
+		char		elmalign;
+		int			n_elems;
+
+		if (elem_type != INT2OID && elem_type != INT4OID && elem_type != INT8OID)
+			elog(ERROR, "Semi-join keys should have integer type");
+
+		if (cache == NULL)
+		{
+			cache = (vops_in_cache *) MemoryContextAllocZero(mcxt, sizeof(vops_in_cache));
+			cache->fixed = vops_in_array_is_fixed(fcinfo->flinfo);
+		}
+		else
+		{
+			hash_destroy(cache->hash);
+			if (cache->array != NULL)
+				pfree(cache->array);
+		}
+
+		get_typlenbyvalalign(elem_type, &elmlen, &elmbyval, &elmalign);
+		deconstruct_array(arr, elem_type, elmlen, elmbyval, elmalign, &elems, &nulls, &n_elems);
+
+		memset(&ctl, 0, sizeof(ctl));
+		ctl.keysize = sizeof(int64);
+		ctl.entrysize = sizeof(int64);
+		ctl.hcxt = mcxt;
+		cache->hash = hash_create("vops_in", Max(n_elems, 64), &ctl,
+								  HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+		cache->min = PG_INT64_MAX;
+		cache->max = PG_INT64_MIN;
+		for (i = 0; i < n_elems; i++)
+		{
+			if (!nulls[i])
+			{
+				int64		key = vops_lookup_get_key(elems[i], elem_type);
+
+				(void) hash_search(cache->hash, &key, HASH_ENTER, NULL);
+				if (key < cache->min)
+					cache->min = key;
+				if (key > cache->max)
+					cache->max = key;
+			}
+		}
+		cache->datum = datum;
+		cache->size = size;
+		if (!cache->fixed)
+		{
+			cache->array = (ArrayType *) MemoryContextAlloc(mcxt, size);
+			memcpy(cache->array, datum, size);
+		}
+		fcinfo->flinfo->fn_extra = cache;
+	}
+
+	vops_lookup_tile_keys(key_tile, key_tid, keys);
+	mask = ~(key_tile->null_mask | key_tile->empty_mask);
+	for (i = 0; i < TILE_SIZE; i++)
+	{
+		if ((mask & ((uint64) 1 << i))
+			&& keys[i] >= cache->min && keys[i] <= cache->max
+			&& hash_search(cache->hash, &keys[i], HASH_FIND, NULL) != NULL)
+		{
+			payload |= (uint64) 1 << i;
+		}
+	}
+	result->hdr = *key_tile;
+	result->payload = payload;
+	PG_RETURN_POINTER(result);
+}
@@ -0,0 +1,866 @@
+/*
+ * vops_scan.c
+ *
+ * VopsScan custom scan node.
+ *
+ * Vector predicate in WHERE clause is evaluated by chain of function calls:
+ * each vector operator is called through fmgr and allocates its result tile.
+ * VopsScan takes over sequential scan of VOPS table if its WHERE clause contains
+ * filter() of predicate composed from comparisons of tile columns with constants,
+ * betwixt() and boolean operators. Such predicate is compiled into tree which is
+ * evaluated in one pass over tiles without function calls and memory allocations,
+ * producing the same mask of selected elements as filter(). Tiles with no
+ * selected elements are skipped before deforming the rest of the tuple.
+ * Remaining quals, projection and aggregation are performed by executor as usual
+ * (vector aggregates use filter_mask set by VopsScan).
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "access/sysattr.h"
+#include "access/transam.h"
+#include "catalog/pg_class.h"
+#include "catalog/pg_language.h"
+#include "catalog/pg_proc.h"
+#include "catalog/pg_type.h"
+#include "commands/explain.h"
+#include "executor/executor.h"
+#include "executor/tuptable.h"
+#include "nodes/extensible.h"
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+#include "optimizer/cost.h"
+#include "optimizer/pathnode.h"
+#include "optimizer/paths.h"
+#include "optimizer/prep.h"
+#include "optimizer/restrictinfo.h"
+#if PG_VERSION_NUM>=120000
+#include "access/table.h"
+#include "access/tableam.h"
+#include "optimizer/optimizer.h"
+#endif
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/lsyscache.h"
+#include "utils/rel.h"
+#include "utils/syscache.h"
+#include "vops.h"
+
+static bool vops_enable_scan = true;
+
+#if PG_VERSION_NUM>=120000
+
+typedef enum
+{
+	VOPS_SCAN_EQ,
+	VOPS_SCAN_NE,
+	VOPS_SCAN_LT,
+	VOPS_SCAN_LE,
+	VOPS_SCAN_GT,
+	VOPS_SCAN_GE,
+	VOPS_SCAN_BETWEEN,
+	VOPS_SCAN_AND,
+	VOPS_SCAN_OR,
+	VOPS_SCAN_NOT
+} vops_scan_op;
+
+/*
+ * Node of compiled vector predicate
+ */
+typedef struct vops_scan_pred
+{
+	vops_scan_op op;
+	AttrNumber	attno;			/* compared tile column */
+	vops_type	tid;			/* type of tile */
+	union
+	{
+		int64		i;
+		double		f;
+	}			low, high;		/* constants (high is used only by betwixt) */
+	struct vops_scan_pred *left;	/* operands of boolean operators */
+	struct vops_scan_pred *right;
+} vops_scan_pred;
+
+typedef struct
+{
+	CustomScanState css;
+	vops_scan_pred *pred;		/* compiled argument of filter() */
+	TableScanDesc scan;
+	TupleTableSlot *heap_slot;	/* slot of table AM used for scan */
+	uint64		skipped;		/* number of tiles skipped by filter */
+} VopsScanState;
+
+static set_rel_pathlist_hook_type prev_set_rel_pathlist_hook;
+
+static Plan *vops_scan_plan(PlannerInfo *root, RelOptInfo *rel, CustomPath *best_path,
+							List *tlist, List *clauses, List *custom_plans);
+static Node *vops_scan_create_state(CustomScan *cscan);
+static void vops_scan_begin(CustomScanState *node, EState *estate, int eflags);
+static TupleTableSlot *vops_scan_exec(CustomScanState *node);
+static void vops_scan_end(CustomScanState *node);
+static void vops_scan_rescan(CustomScanState *node);
+static void vops_scan_explain(CustomScanState *node, List *ancestors, ExplainState *es);
+
+static const CustomPathMethods vops_scan_path_methods = {
+	.CustomName = "VopsScan",
+	.PlanCustomPath = vops_scan_plan,
+};
+
+static const CustomScanMethods vops_scan_plan_methods = {
+	.CustomName = "VopsScan",
+	.CreateCustomScanState = vops_scan_create_state,
+};
+
+static const CustomExecMethods vops_scan_exec_methods = {
+	.CustomName = "VopsScan",
+	.BeginCustomScan = vops_scan_begin,
+	.ExecCustomScan = vops_scan_exec,
+	.EndCustomScan = vops_scan_end,
+	.ReScanCustomScan = vops_scan_rescan,
+	.ExplainCustomScan = vops_scan_explain,
+};
+
+/*
+ * Storage type of tile elements as used in names of C functions implementing
+ * vector operators: date and timestamp tiles share functions with int4 and int8.
+ */
+static char const *
+vops_scan_storage_name(vops_type tid)
+{
+	switch (tid)
+	{
+		case VOPS_CHAR:
+			return "char";
+		case VOPS_INT2:
+			return "int2";
+		case VOPS_INT4:
+		case VOPS_DATE:
+			return "int4";
+		case VOPS_INT8:
+		case VOPS_TIMESTAMP:
+		case VOPS_TIMESTAMPTZ:
+			return "int8";
+		case VOPS_FLOAT4:
+			return "float4";
+		case VOPS_FLOAT8:
+			return "float8";
+		default:
+			return NULL;
+	}
+}
+
+static bool
+vops_scan_is_float(vops_type tid)
+{
+	return tid == VOPS_FLOAT4 || tid == VOPS_FLOAT8;
+}
+
+/*
+ * Get name of C function implementing vector operator
+ */
+static char *
+vops_scan_func_symbol(Oid funcid)
+{
+	HeapTuple	tup = SearchSysCache1(PROCOID, ObjectIdGetDatum(funcid));
+	char	   *symbol = NULL;
+
+	if (HeapTupleIsValid(tup))
+	{
+		Form_pg_proc proc = (Form_pg_proc) GETSTRUCT(tup);
+
+		if (proc->prolang == ClanguageId)
+		{
+			bool		isnull;
+			Datum		prosrc = SysCacheGetAttr(PROCOID, tup, Anum_pg_proc_prosrc, &isnull);
+
+			if (!isnull)
+				symbol = TextDatumGetCString(prosrc);
+		}
+		ReleaseSysCache(tup);
+	}
+	return symbol;
+}
+
+/*
+ * Get value of constant operand of vector comparison
+ */
+static bool
+vops_scan_const(Node *node, vops_type tid, int64 *ival, double *fval)
+{
+	Const	   *c;
+
+	while (IsA(node, RelabelType))
+		node = (Node *) ((RelabelType *) node)->arg;
+	if (!IsA(node, Const) || ((Const *) node)->constisnull)
+		return false;
+
+	c = (Const *) node;
+	switch (c->consttype)
+	{
+		case CHAROID:
+			*ival = DatumGetChar(c->constvalue);
+			break;
+		case INT2OID:
+			*ival = DatumGetInt16(c->constvalue);
+			break;
+		case INT4OID:
+		case DATEOID:
+			*ival = DatumGetInt32(c->constvalue);
+			break;
+		case INT8OID:
+		case TIMESTAMPOID:
+		case TIMESTAMPTZOID:
+			*ival = DatumGetInt64(c->constvalue);
+			break;
+		case FLOAT4OID:
+			*fval = DatumGetFloat4(c->constvalue);
+			return vops_scan_is_float(tid);
+		case FLOAT8OID:
+			*fval = DatumGetFloat8(c->constvalue);
+			return vops_scan_is_float(tid);
+		default:
+			return false;
+	}
+	return !vops_scan_is_float(tid);
+}
+
+/*
+ * Get tile column of the scanned relation
+ */
+static bool
+vops_scan_var(Node *node, Index relid, AttrNumber *attno, vops_type *tid)
+{
+	Var		   *var;
+
+	while (IsA(node, RelabelType))
+		node = (Node *) ((RelabelType *) node)->arg;
+	if (!IsA(node, Var))
+		return false;
+
+	var = (Var *) node;
+	if (var->varno != relid || var->varlevelsup != 0 || var->varattno <= 0)
+		return false;
+
+	*attno = var->varattno;
+	*tid = vops_get_type(var->vartype);
+	return vops_scan_storage_name(*tid) != NULL;
+}
+
+/*
+ * Compile vector predicate. Returns NULL if predicate contains something
+ * else than comparison of tile column with constant, betwixt() and boolean
+ * operators.
+ */
+static vops_scan_pred *
+vops_scan_compile(Node *expr, Index relid)
+{
+	static char const *const cmp_names[] = {"eq", "ne", "lt", "le", "gt", "ge"};
+	static vops_scan_op const commuted[] = {VOPS_SCAN_EQ, VOPS_SCAN_NE, VOPS_SCAN_GT, VOPS_SCAN_GE, VOPS_SCAN_LT, VOPS_SCAN_LE};
+	vops_scan_pred *pred;
+	List	   *args;
+	Oid			funcid;
+	char	   *symbol;
+	char const *storage;
+	bool		lconst;
+	int			i;
+
+	if (IsA(expr, OpExpr))
+	{
+		set_opfuncid((OpExpr *) expr);
+		funcid = ((OpExpr *) expr)->opfuncid;
+		args = ((OpExpr *) expr)->args;
+	}
+	else if (IsA(expr, FuncExpr))
+	{
+		funcid = ((FuncExpr *) expr)->funcid;
+		args = ((FuncExpr *) expr)->args;
+	}
+	else
+		return NULL;
+
+	symbol = vops_scan_func_symbol(funcid);
+	if (symbol == NULL || strncmp(symbol, "vops_", 5) != 0)
+		return NULL;
+
+	pred = (vops_scan_pred *) palloc0(sizeof(vops_scan_pred));
+
+	if (strcmp(symbol, "vops_bool_and") == 0 || strcmp(symbol, "vops_bool_or") == 0)
+	{
+		pred->op = symbol[10] == 'a' ? VOPS_SCAN_AND : VOPS_SCAN_OR;
+		pred->left = vops_scan_compile(linitial(args), relid);
+		pred->right = vops_scan_compile(lsecond(args), relid);
+		return pred->left && pred->right ? pred : NULL;
+	}
+	if (strcmp(symbol, "vops_bool_not") == 0)
+	{
+		pred->op = VOPS_SCAN_NOT;
+		pred->left = vops_scan_compile(linitial(args), relid);
+		return pred->left ? pred : NULL;
+	}
+	if (strncmp(symbol, "vops_betwixt_", 13) == 0)
+	{
+		pred->op = VOPS_SCAN_BETWEEN;
+		if (list_length(args) != 3
+			|| !vops_scan_var(linitial(args), relid, &pred->attno, &pred->tid)
+			|| strcmp(symbol + 13, vops_scan_storage_name(pred->tid)) != 0
+			|| !vops_scan_const(lsecond(args), pred->tid, &pred->low.i, &pred->low.f)
+			|| !vops_scan_const(lthird(args), pred->tid, &pred->high.i, &pred->high.f))
+			return NULL;
+		return pred;
+	}
+	if (list_length(args) != 2)
+		return NULL;
+
+	/* vops_<storage>_<op>_rconst(tile, const) or vops_<storage>_<op>_lconst(const, tile) */
+	if (vops_scan_var(linitial(args), relid, &pred->attno, &pred->tid))
+		lconst = false;
+	else if (vops_scan_var(lsecond(args), relid, &pred->attno, &pred->tid))
+		lconst = true;
+	else
+		return NULL;
+
+	storage = vops_scan_storage_name(pred->tid);
+	for (i = 0; i < lengthof(cmp_names); i++)
+	{
+		char		name[NAMEDATALEN];
+
+		snprintf(name, sizeof(name), "vops_%s_%s_%s", storage, cmp_names[i], lconst ? "lconst" : "rconst");
+		if (strcmp(symbol, name) == 0)
+		{
+			pred->op = lconst ? commuted[i] : (vops_scan_op) i;
+			return vops_scan_const(lconst ? linitial(args) : lsecond(args), pred->tid, &pred->low.i, &pred->low.f)
+				? pred : NULL;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Check that constant can be compared with column as integer or floating point number
+ * without conversion of one of them to another type (like date to timestamp)
+ */
+static bool
+vops_scan_same_domain(Oid coltype, Oid consttype)
+{
+	if (coltype == consttype)
+		return true;
+	if ((coltype == INT2OID || coltype == INT4OID || coltype == INT8OID)
+		&& (consttype == INT2OID || consttype == INT4OID || consttype == INT8OID))
+		return true;
+	return (coltype == FLOAT4OID || coltype == FLOAT8OID)
+		&& (consttype == FLOAT4OID || consttype == FLOAT8OID);
+}
+
+/*
+ * Compile conditions on scalar columns of VOPS foreign table pushed down by vops_fdw:
+ * comparisons of column with constant by built-in operators.
+ * Conditions are combined by AND. OR and NOT are not accepted: NULL OR TRUE is TRUE in SQL,
+ * while vector operators propagate NULL. Attribute numbers of compiled predicate refer
+ * to the foreign table. Returns NULL if some condition can not be compiled.
+ */
+vops_scan_pred *
+vops_scan_compile_quals(List *quals, Index relid)
+{
+	static char const *const cmp_names[] = {"=", "<>", "<", "<=", ">", ">="};
+	static vops_scan_op const commuted[] = {VOPS_SCAN_EQ, VOPS_SCAN_NE, VOPS_SCAN_GT, VOPS_SCAN_GE, VOPS_SCAN_LT, VOPS_SCAN_LE};
+	vops_scan_pred *result = NULL;
+	ListCell   *lc;
+
+	foreach(lc, quals)
+	{
+		Node	   *qual = (Node *) lfirst(lc);
+		OpExpr	   *op;
+		Node	   *arg;
+		Var		   *var;
+		vops_scan_pred *pred;
+		char	   *opname;
+		bool		lconst;
+		int			i;
+
+		if (IsA(qual, RestrictInfo))
+			qual = (Node *) ((RestrictInfo *) qual)->clause;
+		if (!IsA(qual, OpExpr) || list_length(((OpExpr *) qual)->args) != 2)
+			return NULL;
+
+		op = (OpExpr *) qual;
+		if (op->opno >= FirstNormalObjectId)
+			return NULL;
+
+		lconst = !IsA(linitial(op->args), Var);
+		arg = lconst ? linitial(op->args) : lsecond(op->args);
+		var = (Var *) (lconst ? lsecond(op->args) : linitial(op->args));
+		if (!IsA(var, Var) || var->varno != relid || var->varlevelsup != 0 || var->varattno <= 0
+			|| !IsA(arg, Const) || !vops_scan_same_domain(var->vartype, ((Const *) arg)->consttype))
+			return NULL;
+
+		pred = (vops_scan_pred *) palloc0(sizeof(vops_scan_pred));
+		pred->attno = var->varattno;
+		pred->tid = vops_get_type(vops_get_tile_type(var->vartype));
+		if (vops_scan_storage_name(pred->tid) == NULL
+			|| !vops_scan_const(arg, pred->tid, &pred->low.i, &pred->low.f))
+			return NULL;
+
+		opname = get_opname(op->opno);
+		for (i = 0; i < lengthof(cmp_names); i++)
+		{
+			if (opname != NULL && strcmp(opname, cmp_names[i]) == 0)
+				break;
+		}
+		if (i == lengthof(cmp_names))
+			return NULL;
+		pred->op = lconst ? commuted[i] : (vops_scan_op) i;
+
+		if (result != NULL)
+		{
+			vops_scan_pred *conj = (vops_scan_pred *) palloc0(sizeof(vops_scan_pred));
+
+			conj->op = VOPS_SCAN_AND;
+			conj->left = result;
+			conj->right = pred;
+			pred = conj;
+		}
+		result = pred;
+	}
+	return result;
+}
+
+/*
+ * Check that columns of VOPS table used by predicate compiled by vops_scan_compile_quals
+ * have tile types matching types of the foreign table columns.
+ * attnos maps attributes of foreign table to columns of VOPS table (-1 if there is no such column).
+ */
+bool
+vops_scan_check_quals(vops_scan_pred *pred, int const *attnos, vops_type const *types)
+{
+	if (pred->op == VOPS_SCAN_AND)
+		return vops_scan_check_quals(pred->left, attnos, types)
+			&& vops_scan_check_quals(pred->right, attnos, types);
+	return attnos[pred->attno - 1] >= 0 && types[pred->attno - 1] == pred->tid;
+}
+
+/*
+ * Get argument of filter() call or NULL if expression is not filter()
+ */
+static Node *
+vops_scan_filter_arg(Node *node)
+{
+	FuncExpr   *func;
+	char	   *symbol;
+
+	if (!IsA(node, FuncExpr))
+		return NULL;
+
+	func = (FuncExpr *) node;
+	if (list_length(func->args) != 1 || vops_get_type(exprType(linitial(func->args))) != VOPS_BOOL)
+		return NULL;
+
+	symbol = vops_scan_func_symbol(func->funcid);
+	return symbol != NULL && strcmp(symbol, "vops_filter") == 0 ? (Node *) linitial(func->args) : NULL;
+}
+
+static bool
+vops_scan_contains_filter(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (vops_scan_filter_arg(node) != NULL)
+		return true;
+	return expression_tree_walker(node, vops_scan_contains_filter, context);
+}
+
+static int
+vops_scan_pred_size(vops_scan_pred *pred)
+{
+	return pred == NULL ? 0 : 1 + vops_scan_pred_size(pred->left) + vops_scan_pred_size(pred->right);
+}
+
+/*
+ * Find restriction which can be evaluated by VopsScan: there should be only one
+ * filter() call in the quals, because it sets global filter mask.
+ */
+static RestrictInfo *
+vops_scan_find_filter(List *clauses, Index relid, vops_scan_pred **pred)
+{
+	RestrictInfo *filter = NULL;
+	ListCell   *lc;
+
+	foreach(lc, clauses)
+	{
+		RestrictInfo *rinfo = (RestrictInfo *) lfirst(lc);
+		Node	   *arg = vops_scan_filter_arg((Node *) rinfo->clause);
+
+		if (arg != NULL && filter == NULL && !rinfo->pseudoconstant)
+		{
+			*pred = vops_scan_compile(arg, relid);
+			if (*pred == NULL)
+				return NULL;
+			filter = rinfo;
+		}
+		else if (vops_scan_contains_filter((Node *) rinfo->clause, NULL))
+			return NULL;
+	}
+	return filter;
+}
+
+static bool
+vops_scan_uses_system_columns(RelOptInfo *rel)
+{
+	Bitmapset  *attrs = NULL;
+	ListCell   *lc;
+	int			first;
+
+	pull_varattnos((Node *) rel->reltarget->exprs, rel->relid, &attrs);
+	foreach(lc, rel->baserestrictinfo)
+	{
+		pull_varattnos((Node *) ((RestrictInfo *) lfirst(lc))->clause, rel->relid, &attrs);
+	}
+	/* attribute numbers are offset by FirstLowInvalidHeapAttributeNumber */
+	first = bms_next_member(attrs, -1);
+	return first >= 0 && first < -FirstLowInvalidHeapAttributeNumber;
+}
+
+/*
+ * Add VopsScan path for scan of VOPS table with vector predicate
+ */
+static void
+vops_set_rel_pathlist(PlannerInfo *root, RelOptInfo *rel, Index rti, RangeTblEntry *rte)
+{
+	RestrictInfo *filter;
+	vops_scan_pred *pred;
+	CustomPath *cpath;
+	QualCost	filter_cost;
+	Cost		cpu_per_tuple;
+	Cost		run_cost;
+
+	if (prev_set_rel_pathlist_hook)
+		prev_set_rel_pathlist_hook(root, rel, rti, rte);
+
+	if (!vops_enable_scan
+		|| rel->reloptkind != RELOPT_BASEREL
+		|| rte->rtekind != RTE_RELATION
+		|| rte->relkind != RELKIND_RELATION
+		|| rte->tablesample != NULL)
+		return;
+
+	/*
+	 * VopsScan returns virtual tuples, so it can not be used for relations
+	 * which rows are updated or locked or which system columns are accessed.
+	 */
+	if (root->parse->resultRelation == rti
+		|| get_plan_rowmark(root->rowMarks, rti) != NULL
+		|| vops_scan_uses_system_columns(rel))
+		return;
+
+	filter = vops_scan_find_filter(rel->baserestrictinfo, rel->relid, &pred);
+	if (filter == NULL)
+		return;
+
+	cpath = makeNode(CustomPath);
+	cpath->path.pathtype = T_CustomScan;
+	cpath->path.parent = rel;
+	cpath->path.pathtarget = rel->reltarget;
+	cpath->path.param_info = NULL;
+	cpath->path.parallel_aware = false;
+	cpath->path.parallel_safe = rel->consider_parallel;
+	cpath->path.parallel_workers = 0;
+	cpath->path.rows = rel->rows;
+	cpath->path.pathkeys = NIL;
+	cpath->flags = 0;
+	cpath->methods = &vops_scan_path_methods;
+
+	/*
+	 * Cost as sequential scan, but compiled predicate is evaluated without
+	 * function calls: each node of predicate costs as one operator.
+	 */
+	cost_qual_eval_node(&filter_cost, (Node *) filter, root);
+	cpath->path.startup_cost = rel->baserestrictcost.startup - filter_cost.startup;
+	cpu_per_tuple = cpu_tuple_cost + rel->baserestrictcost.per_tuple - filter_cost.per_tuple
+		+ cpu_operator_cost * vops_scan_pred_size(pred);
+	run_cost = seq_page_cost * rel->pages + cpu_per_tuple * rel->tuples;
+	cpath->path.startup_cost += rel->reltarget->cost.startup;
+	run_cost += rel->reltarget->cost.per_tuple * rel->rows;
+	cpath->path.total_cost = cpath->path.startup_cost + run_cost;
+
+	add_path(rel, &cpath->path);
+}
+
+static Plan *
+vops_scan_plan(PlannerInfo *root, RelOptInfo *rel, CustomPath *best_path,
+			   List *tlist, List *clauses, List *custom_plans)
+{
+	CustomScan *cscan = makeNode(CustomScan);
+	vops_scan_pred *pred;
+	RestrictInfo *filter = vops_scan_find_filter(clauses, rel->relid, &pred);
+
+	Assert(filter != NULL);
+
+	cscan->scan.plan.targetlist = tlist;
+	cscan->scan.plan.qual = extract_actual_clauses(list_delete_ptr(list_copy(clauses), filter), false);
+	cscan->scan.scanrelid = rel->relid;
+	cscan->flags = best_path->flags;
+	cscan->custom_exprs = list_make1(vops_scan_filter_arg((Node *) filter->clause));
+	cscan->methods = &vops_scan_plan_methods;
+
+	return &cscan->scan.plan;
+}
+
+static Node *
+vops_scan_create_state(CustomScan *cscan)
+{
+	VopsScanState *state = (VopsScanState *) palloc0(sizeof(VopsScanState));
+
+	NodeSetTag(state, T_CustomScanState);
+	state->css.methods = &vops_scan_exec_methods;
+	return (Node *) state;
+}
+
+static void
+vops_scan_begin(CustomScanState *node, EState *estate, int eflags)
+{
+	VopsScanState *state = (VopsScanState *) node;
+	CustomScan *cscan = (CustomScan *) node->ss.ps.plan;
+	Relation	rel = node->ss.ss_currentRelation;
+
+	state->pred = vops_scan_compile(linitial(cscan->custom_exprs), cscan->scan.scanrelid);
+	if (state->pred == NULL)
+		elog(ERROR, "Failed to compile VOPS filter");
+
+	state->heap_slot = ExecInitExtraTupleSlot(estate, RelationGetDescr(rel), table_slot_callbacks(rel));
+}
+
+/*
+ * Tuple to which compiled predicate is applied
+ */
+typedef struct
+{
+	TupleTableSlot *slot;		/* tuple of VOPS table scanned by VopsScan */
+	Datum	   *values;			/* or deformed tuple of VOPS table scanned by vops_fdw */
+	bool	   *nulls;
+	int const  *attnos;			/* columns of VOPS table for attributes of foreign table */
+} vops_scan_tuple;
+
+static Datum
+vops_scan_getattr(vops_scan_tuple *tuple, AttrNumber attno, bool *isnull)
+{
+	if (tuple->slot != NULL)
+		return slot_getattr(tuple->slot, attno, isnull);
+	*isnull = tuple->nulls[tuple->attnos[attno - 1]];
+	return tuple->values[tuple->attnos[attno - 1]];
+}
+
+/*
+ * Evaluate compiled predicate. Returns false if result is NULL
+ * (vector operators are strict).
+ */
+static bool
+vops_scan_eval(vops_scan_pred *pred, vops_scan_tuple *tuple, vops_bool *result)
+{
+	uint64		payload = 0;
+	int			i;
+
+	switch (pred->op)
+	{
+		case VOPS_SCAN_AND:
+		case VOPS_SCAN_OR:
+			{
+				vops_bool	right;
+
+				if (!vops_scan_eval(pred->left, tuple, result) || !vops_scan_eval(pred->right, tuple, &right))
+					return false;
+				result->payload = pred->op == VOPS_SCAN_AND ? result->payload & right.payload : result->payload | right.payload;
+				result->hdr.null_mask |= right.hdr.null_mask;
+				result->hdr.empty_mask |= right.hdr.empty_mask;
+				return true;
+			}
+		case VOPS_SCAN_NOT:
+			if (!vops_scan_eval(pred->left, tuple, result))
+				return false;
+			result->payload = ~result->payload;
+			return true;
+		default:
+			break;
+	}
+	{
+		bool		isnull;
+		vops_tile_hdr *tile = (vops_tile_hdr *) DatumGetPointer(vops_scan_getattr(tuple, pred->attno, &isnull));
+
+		if (isnull)
+			return false;
+
+#define VOPS_SCAN_LOOP(TILE, COND) \
+		{ TILE *t = (TILE *) tile; for (i = 0; i < TILE_SIZE; i++) payload |= (uint64) (COND) << i; }
+
+#define VOPS_SCAN_CMP(TILE, LOW, HIGH) \
+		switch (pred->op) { \
+		  case VOPS_SCAN_EQ: VOPS_SCAN_LOOP(TILE, t->payload[i] == LOW); break; \
+		  case VOPS_SCAN_NE: VOPS_SCAN_LOOP(TILE, t->payload[i] != LOW); break; \
+		  case VOPS_SCAN_LT: VOPS_SCAN_LOOP(TILE, t->payload[i] < LOW); break; \
+		  case VOPS_SCAN_LE: VOPS_SCAN_LOOP(TILE, t->payload[i] <= LOW); break; \
+		  case VOPS_SCAN_GT: VOPS_SCAN_LOOP(TILE, t->payload[i] > LOW); break; \
+		  case VOPS_SCAN_GE: VOPS_SCAN_LOOP(TILE, t->payload[i] >= LOW); break; \
+		  case VOPS_SCAN_BETWEEN: VOPS_SCAN_LOOP(TILE, t->payload[i] >= LOW && t->payload[i] <= HIGH); break; \
+		  default: Assert(false); \
+		}
+
+		switch (pred->tid)
+		{
+			case VOPS_CHAR:
+				VOPS_SCAN_CMP(vops_char, pred->low.i, pred->high.i);
+				break;
+			case VOPS_INT2:
+				VOPS_SCAN_CMP(vops_int2, pred->low.i, pred->high.i);
+				break;
+			case VOPS_INT4:
+			case VOPS_DATE:
+				VOPS_SCAN_CMP(vops_int4, pred->low.i, pred->high.i);
+				break;
+			case VOPS_INT8:
+			case VOPS_TIMESTAMP:
+			case VOPS_TIMESTAMPTZ:
+				VOPS_SCAN_CMP(vops_int8, pred->low.i, pred->high.i);
+				break;
+			case VOPS_FLOAT4:
+				VOPS_SCAN_CMP(vops_float4, pred->low.f, pred->high.f);
+				break;
+			case VOPS_FLOAT8:
+				VOPS_SCAN_CMP(vops_float8, pred->low.f, pred->high.f);
+				break;
+			default:
+				Assert(false);
+		}
+		result->payload = payload;
+		result->hdr = *tile;
+		return true;
+	}
+}
+
+/*
+ * Evaluate predicate compiled by vops_scan_compile_quals for deformed tuple of VOPS table.
+ * Returns mask of selected elements.
+ */
+uint64
+vops_scan_eval_quals(vops_scan_pred *pred, Datum *values, bool *nulls, int const *attnos)
+{
+	vops_scan_tuple tuple = {NULL, values, nulls, attnos};
+	vops_bool	cond;
+
+	return vops_scan_eval(pred, &tuple, &cond)
+		? cond.payload & ~cond.hdr.empty_mask & ~cond.hdr.null_mask : 0;
+}
+
+/*
+ * Fetch next tuple of VOPS table having tile elements matching filter
+ */
+static TupleTableSlot *
+vops_scan_next(ScanState *node)
+{
+	VopsScanState *state = (VopsScanState *) node;
+	TupleTableSlot *slot = node->ss_ScanTupleSlot;
+	TupleTableSlot *heap_slot = state->heap_slot;
+	EState	   *estate = node->ps.state;
+	vops_scan_tuple tuple = {heap_slot};
+
+	if (state->scan == NULL)
+		state->scan = table_beginscan(node->ss_currentRelation, estate->es_snapshot, 0, NULL);
+
+	while (table_scan_getnextslot(state->scan, estate->es_direction, heap_slot))
+	{
+		vops_bool	cond;
+		uint64		mask;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/* Only columns used in the filter are deformed at this moment */
+		mask = vops_scan_eval(state->pred, &tuple, &cond)
+			? cond.payload & ~cond.hdr.empty_mask & ~cond.hdr.null_mask : 0;
+		if (mask == 0)
+		{
+			state->skipped += 1;
+			continue;
+		}
+		filter_mask = mask;
+
+		/* Scan slot is virtual: pass deformed values of heap tuple to it */
+		slot_getallattrs(heap_slot);
+		ExecClearTuple(slot);
+		memcpy(slot->tts_values, heap_slot->tts_values, sizeof(Datum) * slot->tts_tupleDescriptor->natts);
+		memcpy(slot->tts_isnull, heap_slot->tts_isnull, sizeof(bool) * slot->tts_tupleDescriptor->natts);
+		ExecStoreVirtualTuple(slot);
+		slot->tts_tid = heap_slot->tts_tid;
+		slot->tts_tableOid = heap_slot->tts_tableOid;
+		return slot;
+	}
+	return ExecClearTuple(slot);
+}
+
+/*
+ * Recheck tuple fetched by EvalPlanQual: it should have elements matching filter
+ */
+static bool
+vops_scan_recheck(ScanState *node, TupleTableSlot *slot)
+{
+	VopsScanState *state = (VopsScanState *) node;
+	vops_scan_tuple tuple = {slot};
+	vops_bool	cond;
+
+	filter_mask = vops_scan_eval(state->pred, &tuple, &cond)
+		? cond.payload & ~cond.hdr.empty_mask & ~cond.hdr.null_mask : 0;
+	return filter_mask != 0;
+}
+
+static TupleTableSlot *
+vops_scan_exec(CustomScanState *node)
+{
+	return ExecScan(&node->ss, vops_scan_next, vops_scan_recheck);
+}
+
+static void
+vops_scan_end(CustomScanState *node)
+{
+	VopsScanState *state = (VopsScanState *) node;
+
+	if (state->scan != NULL)
+		table_endscan(state->scan);
+}
+
+static void
+vops_scan_rescan(CustomScanState *node)
+{
+	VopsScanState *state = (VopsScanState *) node;
+
+	if (state->scan != NULL)
+		table_rescan(state->scan, NULL);
+}
+
+static void
+vops_scan_explain(CustomScanState *node, List *ancestors, ExplainState *es)
+{
+	VopsScanState *state = (VopsScanState *) node;
+
+	if (state->pred != NULL)
+		ExplainPropertyInteger("Compiled filter nodes", NULL, vops_scan_pred_size(state->pred), es);
+	if (es->analyze)
+		ExplainPropertyInteger("Tiles skipped", NULL, state->skipped, es);
+}
+
+#endif
+
+void
+vops_scan_init(void)
+{
+	DefineCustomBoolVariable("vops.enable_vops_scan",
+							 "Enables the planner's use of VopsScan custom scan for VOPS tables",
+							 NULL,
+							 &vops_enable_scan,
+							 true,
+							 PGC_USERSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+#if PG_VERSION_NUM>=120000
+	RegisterCustomScanMethods(&vops_scan_plan_methods);
+	prev_set_rel_pathlist_hook = set_rel_pathlist_hook;
+	set_rel_pathlist_hook = vops_set_rel_pathlist;
+#endif
+}
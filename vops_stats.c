@@ -0,0 +1,789 @@
+/*
+ * vops_stats.c
+ *
+ * Planner statistics for tile types.
+ *
+ * ANALYZE of VOPS table collects statistics of tile elements rather than of
+ * tiles themselves: most common values, histogram and correlation of element
+ * values are stored in pg_statistic with element type as type of statistic
+ * values. So restriction estimators of scalar operators can be applied to them.
+ *
+ * Vector predicate passed to filter() is estimated by applying the
+ * estimator of the corresponding scalar operator to the statistics of tile
+ * column. It gives fraction of rows satisfying the predicate. filter() selects
+ * tile if any of its elements satisfies the predicate, so fraction of selected
+ * tiles depends on how values are clustered: it is calculated using correlation
+ * of element values with their physical order.
+ *
+ * Element statistics are also used by planner support functions estimating
+ * number of rows returned by vops_unnest() and reduce(). Vector operators
+ * report cost of processing of the whole tile.
+ */
+#include "postgres.h"
+
+#include <math.h>
+
+#include "fmgr.h"
+#include "catalog/namespace.h"
+#include "catalog/pg_statistic.h"
+#include "catalog/pg_type.h"
+#include "commands/vacuum.h"
+#include "nodes/makefuncs.h"
+#include "nodes/nodeFuncs.h"
+#if PG_VERSION_NUM>=120000
+#include "nodes/supportnodes.h"
+#include "optimizer/optimizer.h"
+#endif
+#include "optimizer/plancat.h"
+#include "utils/builtins.h"
+#include "utils/datum.h"
+#include "utils/lsyscache.h"
+#include "utils/selfuncs.h"
+#include "utils/sortsupport.h"
+#include "utils/typcache.h"
+#include "vops.h"
+
+#define VOPS_STATS_ELEMS_PER_TILE 8	/* number of elements of each sampled tile included in statistics */
+
+#if PG_VERSION_NUM>=170000
+#define VOPS_STATTARGET(stats) ((stats)->attstattarget)
+#else
+#define VOPS_STATTARGET(stats) ((stats)->attr->attstattarget)
+#endif
+
+typedef struct
+{
+	Datum		value;
+	int			pos;			/* position of element in physical order */
+} vops_stats_item;
+
+typedef struct
+{
+	int			first;			/* index of first item of the group in sorted array */
+	int			count;			/* number of items with the same value */
+} vops_stats_group;
+
+static int
+vops_stats_compare_items(const void *a, const void *b, void *arg)
+{
+	return ApplySortComparator(((vops_stats_item const *) a)->value, false,
+							   ((vops_stats_item const *) b)->value, false,
+							   (SortSupport) arg);
+}
+
+static int
+vops_stats_compare_groups(const void *a, const void *b)
+{
+	vops_stats_group const *ga = (vops_stats_group const *) a;
+	vops_stats_group const *gb = (vops_stats_group const *) b;
+
+	if (ga->count != gb->count)
+		return ga->count > gb->count ? -1 : 1;
+	return ga->first - gb->first;
+}
+
+/*
+ * Get value of j-th element of the tile
+ */
+static Datum
+vops_stats_elem_value(vops_tile_hdr *tile, vops_type tid, int j, size_t elem_size)
+{
+	switch (tid)
+	{
+		case VOPS_CHAR:
+			return CharGetDatum(((vops_char *) tile)->payload[j]);
+		case VOPS_INT2:
+			return Int16GetDatum(((vops_int2 *) tile)->payload[j]);
+		case VOPS_INT4:
+		case VOPS_DATE:
+			return Int32GetDatum(((vops_int4 *) tile)->payload[j]);
+		case VOPS_INT8:
+		case VOPS_TIMESTAMP:
+		case VOPS_TIMESTAMPTZ:
+		case VOPS_INTERVAL:
+			return Int64GetDatum(((vops_int8 *) tile)->payload[j]);
+		case VOPS_FLOAT4:
+			return Float4GetDatum(((vops_float4 *) tile)->payload[j]);
+		case VOPS_FLOAT8:
+			return Float8GetDatum(((vops_float8 *) tile)->payload[j]);
+		case VOPS_TEXT:
+			{
+				char	   *src = (char *) (tile + 1) + elem_size * j;
+
+				return PointerGetDatum(cstring_to_text_with_len(src, strnlen(src, elem_size)));
+			}
+		case VOPS_NUMERIC:
+			return vops_numeric_get_datum(((vops_numeric *) tile)->payload[j], ((vops_numeric *) tile)->scale);
+		default:
+			Assert(false);
+	}
+	return (Datum) 0;
+}
+
+/*
+ * Fill statistic slot with values of element type
+ */
+static void
+vops_stats_set_slot(VacAttrStats *stats, int slot, int16 kind, Oid op, Oid collid,
+					Datum *values, int n_values, float4 *numbers, int n_numbers)
+{
+	TypeCacheEntry *typentry = lookup_type_cache(vops_get_elem_type(vops_get_type(stats->attrtypid)), 0);
+
+	stats->stakind[slot] = kind;
+	stats->staop[slot] = op;
+#if PG_VERSION_NUM>=120000
+	stats->stacoll[slot] = collid;
+#endif
+	stats->stavalues[slot] = values;
+	stats->numvalues[slot] = n_values;
+	stats->stanumbers[slot] = numbers;
+	stats->numnumbers[slot] = n_numbers;
+	stats->statypid[slot] = typentry->type_id;
+	stats->statyplen[slot] = typentry->typlen;
+	stats->statypbyval[slot] = typentry->typbyval;
+	stats->statypalign[slot] = typentry->typalign;
+}
+
+/*
+ * Compute statistics of tile elements.
+ * It is simplified version of compute_scalar_stats from analyze.c,
+ * which takes only some elements of each sampled tile.
+ */
+static void
+vops_compute_stats(VacAttrStats *stats,
+				   AnalyzeAttrFetchFunc fetchfunc,
+				   int samplerows,
+				   double totalrows)
+{
+	vops_type	tid = vops_get_type(stats->attrtypid);
+	Oid			elem_type = vops_get_elem_type(tid);
+	Oid			collid = get_typcollation(elem_type);
+	TypeCacheEntry *typentry = lookup_type_cache(elem_type, TYPECACHE_EQ_OPR | TYPECACHE_LT_OPR);
+	int			stattarget = VOPS_STATTARGET(stats);
+	vops_stats_item *items = (vops_stats_item *) palloc(sizeof(vops_stats_item) * samplerows * VOPS_STATS_ELEMS_PER_TILE);
+	vops_stats_group *groups;
+	vops_stats_group *mcv;
+	bool	   *is_mcv;
+	int		   *hist;
+	SortSupportData ssup;
+	MemoryContext old_context;
+	double		total_width = 0;
+	double		total_values;
+	double		corr_xysum = 0;
+	int			n_items = 0;
+	int			n_nulls = 0;
+	int			n_positions = 0;
+	int			n_groups = 0;
+	int			n_mcv = 0;
+	int			n_hist = 0;
+	int			f1 = 0;
+	int			slot = 0;
+	int			i,
+				j;
+
+	if (stattarget < 0)
+		stattarget = default_statistics_target;
+
+	for (i = 0; i < samplerows; i++)
+	{
+		bool		isnull;
+		Datum		value = fetchfunc(stats, i, &isnull);
+		vops_tile_hdr *tile;
+		size_t		elem_size = 0;
+
+		if (isnull)
+		{
+			n_positions += VOPS_STATS_ELEMS_PER_TILE;
+			n_nulls += VOPS_STATS_ELEMS_PER_TILE;
+			continue;
+		}
+		if (tid == VOPS_TEXT)
+		{
+			struct varlena *var = PG_DETOAST_DATUM(value);
+
+			elem_size = VOPS_ELEM_SIZE(var);
+			tile = (vops_tile_hdr *) ((char *) var + LONGALIGN(VARHDRSZ));
+		}
+		else
+			tile = (vops_tile_hdr *) DatumGetPointer(value);
+
+		for (j = 0; j < TILE_SIZE; j += TILE_SIZE / VOPS_STATS_ELEMS_PER_TILE)
+		{
+			if (tile->empty_mask & ((uint64) 1 << j))
+				continue;
+			n_positions += 1;
+			if (tile->null_mask & ((uint64) 1 << j))
+			{
+				n_nulls += 1;
+				continue;
+			}
+			items[n_items].value = vops_stats_elem_value(tile, tid, j, elem_size);
+			items[n_items].pos = n_items;
+			total_width += typentry->typlen > 0 ? typentry->typlen : VARSIZE_ANY(DatumGetPointer(items[n_items].value));
+			n_items += 1;
+		}
+	}
+	if (n_positions == 0)
+		return;
+
+	stats->stats_valid = true;
+	stats->stanullfrac = (double) n_nulls / n_positions;
+	if (n_items == 0)
+	{
+		stats->stawidth = 0;
+		stats->stadistinct = 0.0;
+		return;
+	}
+	stats->stawidth = total_width / n_items;
+
+	/* Sort elements and group duplicates */
+	memset(&ssup, 0, sizeof(ssup));
+	ssup.ssup_cxt = CurrentMemoryContext;
+	ssup.ssup_collation = collid;
+	ssup.ssup_nulls_first = false;
+	ssup.abbreviate = false;
+	PrepareSortSupportFromOrderingOp(typentry->lt_opr, &ssup);
+
+	qsort_arg(items, n_items, sizeof(vops_stats_item), vops_stats_compare_items, &ssup);
+
+	groups = (vops_stats_group *) palloc(sizeof(vops_stats_group) * n_items);
+	for (i = 0; i < n_items; i++)
+	{
+		if (i == 0 || ApplySortComparator(items[i - 1].value, false, items[i].value, false, &ssup) != 0)
+		{
+			groups[n_groups].first = i;
+			groups[n_groups].count = 0;
+			n_groups += 1;
+		}
+		groups[n_groups - 1].count += 1;
+		corr_xysum += (double) i * items[i].pos;
+	}
+	for (i = 0; i < n_groups; i++)
+		f1 += groups[i].count == 1;
+
+	/*
+	 * Estimate number of distinct values using Haas and Stokes estimator, as
+	 * ANALYZE does. Number of distinct values is stored as absolute value,
+	 * because number of tuples in VOPS table is number of tiles, not elements.
+	 */
+	total_values = totalrows * TILE_SIZE * n_items / ((double) samplerows * VOPS_STATS_ELEMS_PER_TILE);
+	if (f1 == 0 || total_values <= n_items)
+	{
+		/* Each value appears more than once: assume all distinct values are present in the sample */
+		stats->stadistinct = n_groups;
+	}
+	else
+	{
+		double		numer = (double) n_items * n_groups;
+		double		denom = (n_items - f1) + f1 * n_items / total_values;
+		double		stadistinct = numer / denom;
+
+		if (stadistinct < n_groups)
+			stadistinct = n_groups;
+		if (stadistinct > total_values)
+			stadistinct = total_values;
+		stats->stadistinct = floor(stadistinct + 0.5);
+	}
+
+	/* Most common values are values which are significantly more frequent than average */
+	mcv = (vops_stats_group *) palloc(sizeof(vops_stats_group) * n_groups);
+	memcpy(mcv, groups, sizeof(vops_stats_group) * n_groups);
+	qsort(mcv, n_groups, sizeof(vops_stats_group), vops_stats_compare_groups);
+	if (f1 == 0 && n_groups <= stattarget)
+		n_mcv = n_groups;
+	else
+	{
+		double		mincount = 1.25 * n_items / n_groups;
+
+		while (n_mcv < n_groups && n_mcv < stattarget
+			   && mcv[n_mcv].count > 1 && mcv[n_mcv].count >= mincount)
+		{
+			n_mcv += 1;
+		}
+	}
+
+	/* Histogram is built for the rest of values */
+	is_mcv = (bool *) palloc0(sizeof(bool) * n_items);
+	for (i = 0; i < n_mcv; i++)
+		is_mcv[mcv[i].first] = true;
+	hist = (int *) palloc(sizeof(int) * n_items);
+	for (i = 0; i < n_groups; i++)
+	{
+		if (!is_mcv[groups[i].first])
+		{
+			for (j = 0; j < groups[i].count; j++)
+				hist[n_hist++] = groups[i].first + j;
+		}
+	}
+
+	old_context = MemoryContextSwitchTo(stats->anl_context);
+
+	if (n_mcv > 0)
+	{
+		Datum	   *values = (Datum *) palloc(sizeof(Datum) * n_mcv);
+		float4	   *freqs = (float4 *) palloc(sizeof(float4) * n_mcv);
+
+		for (i = 0; i < n_mcv; i++)
+		{
+			values[i] = datumCopy(items[mcv[i].first].value, typentry->typbyval, typentry->typlen);
+			freqs[i] = (double) mcv[i].count / n_positions;
+		}
+		vops_stats_set_slot(stats, slot++, STATISTIC_KIND_MCV, typentry->eq_opr, collid,
+							values, n_mcv, freqs, n_mcv);
+	}
+
+	if (n_groups - n_mcv >= 2)
+	{
+		int			n_bounds = Min(n_groups - n_mcv, stattarget + 1);
+		Datum	   *values = (Datum *) palloc(sizeof(Datum) * n_bounds);
+
+		for (i = 0; i < n_bounds; i++)
+		{
+			values[i] = datumCopy(items[hist[(int64) (n_hist - 1) * i / (n_bounds - 1)]].value,
+								  typentry->typbyval, typentry->typlen);
+		}
+		vops_stats_set_slot(stats, slot++, STATISTIC_KIND_HISTOGRAM, typentry->lt_opr, collid,
+							values, n_bounds, NULL, 0);
+	}
+
+	if (n_items > 1)
+	{
+		/* Positions and ranks are both permutations of 0..n_items-1 */
+		double		n = n_items;
+		double		corr_xsum = (n - 1) * n / 2.0;
+		double		corr_x2sum = (n - 1) * n * (2 * n - 1) / 6.0;
+		float4	   *corr = (float4 *) palloc(sizeof(float4));
+
+		*corr = (n * corr_xysum - corr_xsum * corr_xsum) / (n * corr_x2sum - corr_xsum * corr_xsum);
+		vops_stats_set_slot(stats, slot++, STATISTIC_KIND_CORRELATION, typentry->lt_opr, collid,
+							NULL, 0, corr, 1);
+	}
+
+	MemoryContextSwitchTo(old_context);
+}
+
+/*
+ * Type analyze function for tile types
+ */
+PG_FUNCTION_INFO_V1(vops_typanalyze);
+Datum
+vops_typanalyze(PG_FUNCTION_ARGS)
+{
+	VacAttrStats *stats = (VacAttrStats *) PG_GETARG_POINTER(0);
+	vops_type	tid = vops_get_type(stats->attrtypid);
+	TypeCacheEntry *typentry;
+
+	/* Statistics are not collected for boolean tiles and for intervals stored as deltatime */
+	if (tid == VOPS_LAST || tid == VOPS_BOOL || tid == VOPS_INTERVAL)
+		PG_RETURN_BOOL(false);
+
+	typentry = lookup_type_cache(vops_get_elem_type(tid), TYPECACHE_EQ_OPR | TYPECACHE_LT_OPR);
+	if (!OidIsValid(typentry->eq_opr) || !OidIsValid(typentry->lt_opr))
+		PG_RETURN_BOOL(false);
+
+	if (VOPS_STATTARGET(stats) < 0)
+		VOPS_STATTARGET(stats) = default_statistics_target;
+
+	stats->compute_stats = vops_compute_stats;
+	/* Sample the same number of tuples as for scalar column: each tile contains many elements */
+	stats->minrows = 300 * VOPS_STATTARGET(stats);
+
+	PG_RETURN_BOOL(true);
+}
+
+#if PG_VERSION_NUM>=120000
+
+/*
+ * Construct Var referencing elements of tile column: statistics of tile
+ * column are collected for its elements. Returns NULL if expression is not
+ * a tile column.
+ */
+static Var *
+vops_elem_var(Node *tile)
+{
+	vops_type	tid;
+	Var		   *var;
+
+	while (IsA(tile, RelabelType))
+		tile = (Node *) ((RelabelType *) tile)->arg;
+	if (!IsA(tile, Var))
+		return NULL;
+
+	tid = vops_get_type(((Var *) tile)->vartype);
+	if (tid == VOPS_LAST || tid == VOPS_BOOL || tid == VOPS_INTERVAL)
+		return NULL;
+
+	var = (Var *) copyObject(tile);
+	var->vartype = vops_get_elem_type(tid);
+	var->vartypmod = -1;
+	var->varcollid = get_typcollation(var->vartype);
+	return var;
+}
+
+/*
+ * Get correlation of elements of the tile column with their physical order
+ */
+static double
+vops_get_correlation(PlannerInfo *root, Var *var, int varRelid)
+{
+	VariableStatData vardata;
+	AttStatsSlot sslot;
+	double		correlation = 0;
+
+	examine_variable(root, (Node *) var, varRelid, &vardata);
+	if (HeapTupleIsValid(vardata.statsTuple)
+		&& get_attstatsslot(&sslot, vardata.statsTuple,
+							STATISTIC_KIND_CORRELATION, InvalidOid,
+							ATTSTATSSLOT_NUMBERS))
+	{
+		if (sslot.nnumbers == 1)
+			correlation = sslot.numbers[0];
+		free_attstatsslot(&sslot);
+	}
+	ReleaseVariableStats(vardata);
+	return correlation;
+}
+
+/*
+ * Estimate fraction of elements satisfying comparison of tile column with scalar
+ * expression, using estimator of the operator with the same name for element type.
+ * Returns -1 if selectivity can not be estimated.
+ */
+static Selectivity
+vops_compare_selectivity(PlannerInfo *root, char const *opname, Node *left, Node *right,
+						 int varRelid, double *correlation)
+{
+	vops_type	ltid = vops_get_type(exprType(left));
+	vops_type	rtid = vops_get_type(exprType(right));
+	Var		   *var;
+	Oid			elem_type;
+	Oid			opno;
+
+	/* Only comparison of tile column with scalar is supported */
+	if ((ltid == VOPS_LAST) == (rtid == VOPS_LAST))
+		return -1;
+
+	var = vops_elem_var(ltid != VOPS_LAST ? left : right);
+	if (var == NULL)
+		return -1;
+	elem_type = var->vartype;
+
+	opno = OpernameGetOprid(list_make1(makeString((char *) opname)),
+							ltid != VOPS_LAST ? elem_type : exprType(left),
+							rtid != VOPS_LAST ? elem_type : exprType(right));
+	if (!OidIsValid(opno))
+		return -1;
+
+	*correlation = Max(*correlation, fabs(vops_get_correlation(root, var, varRelid)));
+
+	return restriction_selectivity(root, opno,
+								   ltid != VOPS_LAST ? list_make2(var, right) : list_make2(left, var),
+								   var->varcollid, varRelid);
+}
+
+/*
+ * Estimate fraction of elements for which vops_bool expression is true.
+ * Returns -1 if selectivity can not be estimated.
+ */
+static Selectivity
+vops_bool_selectivity(PlannerInfo *root, Node *expr, int varRelid, double *correlation)
+{
+	Oid			funcid;
+	List	   *args;
+	char	   *fname;
+
+	if (IsA(expr, OpExpr))
+	{
+		OpExpr	   *op = (OpExpr *) expr;
+
+		if (list_length(op->args) == 2 && vops_get_type(op->opresulttype) == VOPS_BOOL
+			&& vops_get_type(exprType(linitial(op->args))) != VOPS_BOOL)
+		{
+			return vops_compare_selectivity(root, get_opname(op->opno),
+											linitial(op->args), lsecond(op->args),
+											varRelid, correlation);
+		}
+		set_opfuncid(op);
+		funcid = op->opfuncid;
+		args = op->args;
+	}
+	else if (IsA(expr, FuncExpr))
+	{
+		funcid = ((FuncExpr *) expr)->funcid;
+		args = ((FuncExpr *) expr)->args;
+	}
+	else
+		return -1;
+
+	fname = get_func_name(funcid);
+	if (fname == NULL)
+		return -1;
+
+	if (strcmp(fname, "vops_bool_not") == 0 && list_length(args) == 1)
+	{
+		Selectivity s = vops_bool_selectivity(root, linitial(args), varRelid, correlation);
+
+		return s < 0 ? s : 1.0 - s;
+	}
+	if ((strcmp(fname, "vops_bool_and") == 0 || strcmp(fname, "vops_bool_or") == 0) && list_length(args) == 2)
+	{
+		Selectivity s1 = vops_bool_selectivity(root, linitial(args), varRelid, correlation);
+		Selectivity s2 = vops_bool_selectivity(root, lsecond(args), varRelid, correlation);
+
+		if (s1 < 0 || s2 < 0)
+			return -1;
+		return strcmp(fname, "vops_bool_and") == 0 ? s1 * s2 : s1 + s2 - s1 * s2;
+	}
+	if (strcmp(fname, "betwixt") == 0 && list_length(args) == 3)
+	{
+		Selectivity lo = vops_compare_selectivity(root, ">=", linitial(args), lsecond(args), varRelid, correlation);
+		Selectivity hi = vops_compare_selectivity(root, "<=", linitial(args), lthird(args), varRelid, correlation);
+		Selectivity s;
+
+		if (lo < 0 || hi < 0)
+			return -1;
+		/* The same as range query in clauselist_selectivity */
+		s = lo + hi - 1.0;
+		if (s <= 0.0)
+			s = s < -0.01 ? DEFAULT_RANGE_INEQ_SEL : 1.0e-10;
+		return s;
+	}
+	return -1;
+}
+
+/*
+ * Estimate fraction of tiles selected by filter(condition).
+ * Fraction of selected rows is returned in row_sel.
+ * Returns -1 if selectivity can not be estimated.
+ */
+static Selectivity
+vops_filter_selectivity(PlannerInfo *root, Node *condition, int varRelid, Selectivity *row_sel)
+{
+	double		correlation = 0;
+	Selectivity sel = vops_bool_selectivity(root, condition, varRelid, &correlation);
+	Selectivity tile_sel;
+
+	if (sel < 0)
+		return -1;
+	CLAMP_PROBABILITY(sel);
+	*row_sel = sel;
+
+	/*
+	 * If elements are randomly distributed, then tile is selected if any
+	 * of its TILE_SIZE elements matches. If they are ordered, then
+	 * fraction of selected tiles is the same as fraction of rows.
+	 */
+	tile_sel = correlation * sel + (1.0 - correlation) * (1.0 - pow(1.0 - sel, TILE_SIZE));
+	CLAMP_PROBABILITY(tile_sel);
+	return tile_sel;
+}
+
+static bool
+vops_is_filter(Node *node)
+{
+	if (IsA(node, FuncExpr) && list_length(((FuncExpr *) node)->args) == 1
+		&& vops_get_type(exprType(linitial(((FuncExpr *) node)->args))) == VOPS_BOOL)
+	{
+		char	   *fname = get_func_name(((FuncExpr *) node)->funcid);
+
+		return fname != NULL && strcmp(fname, "filter") == 0;
+	}
+	return false;
+}
+
+static bool
+vops_find_filters(Node *node, void *context)
+{
+	List	  **filters = (List **) context;
+
+	if (node == NULL)
+		return false;
+	if (vops_is_filter(node))
+	{
+		*filters = lappend(*filters, node);
+		return false;
+	}
+	return expression_tree_walker(node, vops_find_filters, context);
+}
+
+/*
+ * Estimate number of rows produced by vops_unnest() from one tile.
+ * vops_unnest() returns only elements selected by filter() in WHERE clause,
+ * so if there is single filter, then number of rows is TILE_SIZE multiplied
+ * by fraction of elements matching the filter in the selected tiles.
+ */
+static double
+vops_unnest_rows(PlannerInfo *root)
+{
+	List	   *filters = NIL;
+	double		rows = TILE_SIZE;
+
+	if (root == NULL || root->parse->jointree == NULL)
+		return rows;
+
+	vops_find_filters(root->parse->jointree->quals, (void *) &filters);
+	if (list_length(filters) == 1)
+	{
+		Selectivity row_sel;
+		Selectivity tile_sel = vops_filter_selectivity(root, linitial(((FuncExpr *) linitial(filters))->args), 0, &row_sel);
+
+		if (tile_sel > 0)
+			rows = clamp_row_est(TILE_SIZE * row_sel / tile_sel);
+	}
+	return rows;
+}
+
+/*
+ * Estimate number of groups returned by reduce(map(group_by, ...)) using
+ * number of distinct values of elements of tile columns used in group_by.
+ * Returns -1 if it can not be estimated.
+ */
+static double
+vops_reduce_rows(PlannerInfo *root, FuncExpr *reduce)
+{
+	Aggref	   *map;
+	char	   *fname;
+	List	   *vars;
+	List	   *elem_vars = NIL;
+	ListCell   *lc;
+	double		input_rows = 0;
+
+	if (root == NULL || list_length(reduce->args) != 1 || !IsA(linitial(reduce->args), Aggref))
+		return -1;
+
+	map = (Aggref *) linitial(reduce->args);
+	fname = get_func_name(map->aggfnoid);
+	if (fname == NULL || strcmp(fname, "map") != 0 || map->args == NIL)
+		return -1;
+
+	vars = pull_var_clause((Node *) ((TargetEntry *) linitial(map->args))->expr, PVC_RECURSE_PLACEHOLDERS);
+	foreach(lc, vars)
+	{
+		Var		   *var = (Var *) lfirst(lc);
+		Var		   *elem_var;
+		RelOptInfo *rel;
+
+		if (var->varlevelsup != 0 || var->varno >= root->simple_rel_array_size
+			|| (rel = root->simple_rel_array[var->varno]) == NULL)
+			return -1;
+		elem_var = vops_elem_var((Node *) var);
+		if (elem_var == NULL)
+			return -1;
+		elem_vars = lappend(elem_vars, elem_var);
+		input_rows = Max(input_rows, rel->tuples * TILE_SIZE);
+	}
+	if (elem_vars == NIL)
+		return 1;
+
+	return estimate_num_groups(root, elem_vars, clamp_row_est(input_rows),
+#if PG_VERSION_NUM>=140000
+							   NULL,
+#endif
+							   NULL);
+}
+
+#endif
+
+/*
+ * Planner support function for filter(): estimates fraction of tiles
+ * containing elements satisfying vector predicate.
+ */
+PG_FUNCTION_INFO_V1(vops_filter_support);
+Datum
+vops_filter_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM>=120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestSelectivity))
+	{
+		SupportRequestSelectivity *req = (SupportRequestSelectivity *) rawreq;
+		Selectivity row_sel;
+		Selectivity sel;
+
+		if (req->is_join || list_length(req->args) != 1)
+			PG_RETURN_POINTER(NULL);
+
+		sel = vops_filter_selectivity(req->root, linitial(req->args), req->varRelid, &row_sel);
+		if (sel < 0)
+			PG_RETURN_POINTER(NULL);
+		req->selectivity = sel;
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+/*
+ * Planner support function for vops_unnest(): estimates number of rows
+ * produced from one tile.
+ */
+PG_FUNCTION_INFO_V1(vops_unnest_support);
+Datum
+vops_unnest_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM>=120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestRows))
+	{
+		SupportRequestRows *req = (SupportRequestRows *) rawreq;
+
+		req->rows = vops_unnest_rows(req->root);
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+/*
+ * Planner support function for reduce(): estimates number of groups
+ */
+PG_FUNCTION_INFO_V1(vops_reduce_support);
+Datum
+vops_reduce_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM>=120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestRows))
+	{
+		SupportRequestRows *req = (SupportRequestRows *) rawreq;
+		double		rows;
+
+		if (req->node == NULL || !IsA(req->node, FuncExpr))
+			PG_RETURN_POINTER(NULL);
+
+		rows = vops_reduce_rows(req->root, (FuncExpr *) req->node);
+		if (rows < 0)
+			PG_RETURN_POINTER(NULL);
+		req->rows = rows;
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+/*
+ * Planner support function for vector operators and functions: they process
+ * the whole tile in one call.
+ */
+PG_FUNCTION_INFO_V1(vops_operator_support);
+Datum
+vops_operator_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM>=120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost))
+	{
+		SupportRequestCost *req = (SupportRequestCost *) rawreq;
+
+		req->startup = 0;
+		req->per_tuple = vops_tile_operator_cost;
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+